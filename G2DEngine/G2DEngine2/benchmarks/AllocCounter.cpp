@@ -0,0 +1,19 @@
+#include "AllocCounter.h"
+#include "../tools/AllocHook.h"
+
+#include <atomic>
+
+namespace {
+    std::atomic<std::size_t> g_allocations{ 0 };
+
+    void countAllocation(std::size_t) {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Se instala durante la inicialización estática, antes de que corra ningún benchmark
+    const bool g_installed = (AllocHook::set(&countAllocation), true);
+} // namespace
+
+std::size_t Bench::allocationCount() {
+    return g_allocations.load(std::memory_order_relaxed);
+}
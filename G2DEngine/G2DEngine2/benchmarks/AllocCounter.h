@@ -0,0 +1,18 @@
+#pragma once
+
+/**
+ * @file AllocCounter.h
+ * @brief Cuenta las llamadas a operator new del binario de benchmarks.
+ *
+ * AllocCounter.cpp cuenta con el hook de tools/AllocHook.cpp, que reemplaza operator new/delete
+ * globales solo en este ejecutable.
+ */
+
+#include <cstddef>
+
+namespace Bench {
+
+    /** @brief Número total de llamadas a operator new desde el arranque. */
+    std::size_t allocationCount();
+
+} // namespace Bench
@@ -0,0 +1,70 @@
+#include "Benchmark.h"
+
+#include "Utilities/CVector2.h"
+
+#include <vector>
+
+/**
+ * @file BenchCVector2.cpp
+ * @brief Operaciones de CVector2 sobre arreglos de param vectores.
+ */
+
+namespace {
+
+    std::vector<CVector2> makeVectors(std::size_t count) {
+        std::vector<CVector2> v;
+        v.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            v.emplace_back(float(i % 97) + 0.5f, float(i % 89) - 40.f);
+        }
+        return v;
+    }
+
+} // namespace
+
+static void BM_CVector2_Arithmetic(Bench::State& state) {
+    auto v = makeVectors(state.param());
+    state.setItemsPerIteration(double(v.size()));
+    const CVector2 offset(0.25f, -0.5f);
+    for (auto _ : state) {
+        for (auto& p : v) p = (p + offset) * 0.999f - offset / 2.f;
+        Bench::doNotOptimize(v.data());
+    }
+}
+G2D_BENCHMARK(BM_CVector2_Arithmetic, 64, 4096);
+
+static void BM_CVector2_Length(Bench::State& state) {
+    auto v = makeVectors(state.param());
+    state.setItemsPerIteration(double(v.size()));
+    for (auto _ : state) {
+        float sum = 0.f;
+        for (const auto& p : v) sum += p.length();
+        Bench::doNotOptimize(sum);
+    }
+}
+G2D_BENCHMARK(BM_CVector2_Length, 64, 4096);
+
+static void BM_CVector2_Normalized(Bench::State& state) {
+    auto v = makeVectors(state.param());
+    state.setItemsPerIteration(double(v.size()));
+    for (auto _ : state) {
+        CVector2 acc;
+        for (const auto& p : v) acc += p.normalized();
+        Bench::doNotOptimize(acc);
+    }
+}
+G2D_BENCHMARK(BM_CVector2_Normalized, 64, 4096);
+
+static void BM_CVector2_DistanceLerp(Bench::State& state) {
+    auto v = makeVectors(state.param());
+    state.setItemsPerIteration(double(v.size()));
+    for (auto _ : state) {
+        float sum = 0.f;
+        for (std::size_t i = 1; i < v.size(); ++i) {
+            sum += CVector2::distance(v[i - 1], v[i]);
+            sum += CVector2::lerp(v[i - 1], v[i], 0.5f).dot(v[i]);
+        }
+        Bench::doNotOptimize(sum);
+    }
+}
+G2D_BENCHMARK(BM_CVector2_DistanceLerp, 64, 4096);
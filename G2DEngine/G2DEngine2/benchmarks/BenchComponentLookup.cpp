@@ -0,0 +1,86 @@
+#include "Benchmark.h"
+
+#include "ECS/Actor.h"
+#include "ECS/Transform.h"
+
+/**
+ * @file BenchComponentLookup.cpp
+ * @brief Compara la búsqueda lineal con dynamic_pointer_cast (implementación anterior de
+ * Actor::getComponent) contra la tabla de slots por ComponentType.
+ *
+ * El parámetro es el número de componentes por actor. El componente buscado queda al
+ * final de la lista, que es el peor caso para el recorrido lineal.
+ */
+
+namespace {
+
+    // Componente sin StaticType: ocupa la lista pero nunca un slot.
+    class FillerComponent : public Component {
+    public:
+        void start() override {}
+        void update(float) override {}
+        void render(const EngineUtilities::TSharedPointer<Window>&) override {}
+        void destroy() override {}
+    };
+
+    // Componente buscado; se añade al final de la lista.
+    class ProbeComponent : public Component {
+    public:
+        static constexpr ComponentType StaticType = ComponentType::PHYSICS;
+
+        ProbeComponent() : Component(ComponentType::PHYSICS) {}
+        void start() override {}
+        void update(float) override {}
+        void render(const EngineUtilities::TSharedPointer<Window>&) override {}
+        void destroy() override {}
+    };
+
+    // Actor con count componentes en total: CShape + Transform + relleno + ProbeComponent.
+    EngineUtilities::TSharedPointer<Actor> makeActor(std::size_t count) {
+        auto actor = EngineUtilities::MakeShared<Actor>("Bench");
+        for (std::size_t i = actor->getComponents().size() + 1; i < count; ++i) {
+            actor->addComponent(EngineUtilities::MakeShared<FillerComponent>());
+        }
+        actor->addComponent(EngineUtilities::MakeShared<ProbeComponent>());
+        return actor;
+    }
+
+    // Réplica de la búsqueda lineal original (dynamic_pointer_cast por componente).
+    template<typename T>
+    EngineUtilities::TSharedPointer<T> linearLookup(
+        const std::vector<EngineUtilities::TSharedPointer<Component>>& comps) {
+        for (const auto& comp : comps) {
+            if (auto casted = comp.template dynamic_pointer_cast<T>()) return casted;
+        }
+        return EngineUtilities::TSharedPointer<T>();
+    }
+
+} // namespace
+
+static void BM_GetComponent_LinearScan(Bench::State& state) {
+    auto actor = makeActor(state.param());
+    const auto& comps = actor->getComponents();
+    for (auto _ : state) {
+        auto probe = linearLookup<ProbeComponent>(comps);
+        Bench::doNotOptimize(probe.get());
+    }
+}
+G2D_BENCHMARK(BM_GetComponent_LinearScan, 4, 64, 1024);
+
+static void BM_GetComponent_Slot(Bench::State& state) {
+    auto actor = makeActor(state.param());
+    for (auto _ : state) {
+        auto probe = actor->getComponent<ProbeComponent>();
+        Bench::doNotOptimize(probe.get());
+    }
+}
+G2D_BENCHMARK(BM_GetComponent_Slot, 4, 64, 1024);
+
+static void BM_GetComponentPtr_Slot(Bench::State& state) {
+    auto actor = makeActor(state.param());
+    for (auto _ : state) {
+        ProbeComponent* probe = actor->getComponentPtr<ProbeComponent>();
+        Bench::doNotOptimize(probe);
+    }
+}
+G2D_BENCHMARK(BM_GetComponentPtr_Slot, 4, 64, 1024);
@@ -0,0 +1,87 @@
+#include "Benchmark.h"
+#include "AllocCounter.h"
+
+#include "ECS/Actor.h"
+#include "ECS/Transform.h"
+#include "CShape.h"
+
+/**
+ * @file BenchComponentPool.cpp
+ * @brief Coste de crear y destruir componentes con MakeShared (malloc por componente)
+ * frente a MakePooled (bloques reciclados del pool de cada tipo).
+ *
+ * El parámetro es el número de actores/juegos de componentes creados por iteración.
+ * Cada caso reporta allocs/item: llamadas a operator new por actor creado.
+ */
+
+namespace {
+
+    using ComponentList = std::vector<EngineUtilities::TSharedPointer<Component>>;
+
+    // Lo que hacía el constructor de Actor antes de los pools
+    void spawnShared(ComponentList& out, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            out.push_back(EngineUtilities::MakeShared<CShape>());
+            out.push_back(EngineUtilities::MakeShared<Transform>());
+        }
+    }
+
+    void spawnPooled(ComponentList& out, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            out.push_back(EngineUtilities::MakePooled<CShape>());
+            out.push_back(EngineUtilities::MakePooled<Transform>());
+        }
+    }
+
+    template<typename SpawnFn>
+    void runSpawn(Bench::State& state, SpawnFn spawn) {
+        const std::size_t count = state.param();
+        ComponentList comps;
+        comps.reserve(count * 2);
+
+        // Calentamiento: deja los pools con capacidad para count actores
+        spawn(comps, count);
+        comps.clear();
+
+        const std::size_t allocsBefore = Bench::allocationCount();
+        for (auto _ : state) {
+            spawn(comps, count);
+            comps.clear();
+        }
+        const double allocs = double(Bench::allocationCount() - allocsBefore);
+        state.setItemsPerIteration(double(count));
+        state.setCounter("allocs/item", allocs / double(state.iterations() * count));
+    }
+
+} // namespace
+
+static void BM_SpawnComponents_MakeShared(Bench::State& state) {
+    runSpawn(state, spawnShared);
+}
+G2D_BENCHMARK(BM_SpawnComponents_MakeShared, 1000, 10000);
+
+static void BM_SpawnComponents_MakePooled(Bench::State& state) {
+    runSpawn(state, spawnPooled);
+}
+G2D_BENCHMARK(BM_SpawnComponents_MakePooled, 1000, 10000);
+
+static void BM_SpawnActors(Bench::State& state) {
+    const std::size_t count = state.param();
+    std::vector<EngineUtilities::TSharedPointer<Actor>> actors;
+    actors.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i) actors.push_back(EngineUtilities::MakeShared<Actor>("A"));
+    actors.clear();
+
+    const std::size_t allocsBefore = Bench::allocationCount();
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; ++i) actors.push_back(EngineUtilities::MakeShared<Actor>("A"));
+        actors.clear();
+    }
+    const double allocs = double(Bench::allocationCount() - allocsBefore);
+    state.setItemsPerIteration(double(count));
+    state.setCounter("allocs/item", allocs / double(state.iterations() * count));
+    state.setCounter("pool.CShape.chunks", double(EngineUtilities::GetObjectPool<CShape>().chunkCount()));
+    state.setCounter("pool.Transform.chunks", double(EngineUtilities::GetObjectPool<Transform>().chunkCount()));
+}
+G2D_BENCHMARK(BM_SpawnActors, 1000, 10000);
@@ -0,0 +1,145 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+    namespace {
+        struct Options {
+            std::string filter;
+            std::string jsonPath;   // vacío: sin salida JSON; "-": a stdout
+            double minTimeSec = 0.1;
+        };
+
+        Options parseOptions(int argc, char** argv) {
+            Options o;
+            for (int i = 1; i < argc; ++i) {
+                if (!std::strcmp(argv[i], "--filter") && i + 1 < argc) o.filter = argv[++i];
+                else if (!std::strcmp(argv[i], "--min-time") && i + 1 < argc) o.minTimeSec = std::atof(argv[++i]);
+                else if (!std::strcmp(argv[i], "--json") && i + 1 < argc) o.jsonPath = argv[++i];
+            }
+            return o;
+        }
+
+        struct Result {
+            std::string name;
+            std::size_t param;
+            std::size_t iterations;
+            double nsPerOp;
+            double nsPerItem;
+            std::vector<std::pair<std::string, double>> counters;
+        };
+
+        // Los nombres de caso y contador son identificadores; basta con escapar comillas y barras invertidas
+        void writeJsonString(std::FILE* f, const std::string& s) {
+            std::fputc('"', f);
+            for (char c : s) {
+                if (c == '"' || c == '\\') std::fputc('\\', f);
+                std::fputc(c, f);
+            }
+            std::fputc('"', f);
+        }
+
+        // Un objeto por (caso, parámetro); las claves son estables para poder comparar ejecuciones
+        bool writeJson(const std::string& path, const std::vector<Result>& results, const Options& opts) {
+            std::FILE* f = (path == "-") ? stdout : std::fopen(path.c_str(), "w");
+            if (!f) return false;
+
+            char date[32] = "";
+            const std::time_t now = std::time(nullptr);
+            std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+            std::fprintf(f, "{\n  \"context\": {\n");
+            std::fprintf(f, "    \"date\": \"%s\",\n", date);
+#if defined(__VERSION__)
+            std::fprintf(f, "    \"compiler\": ");
+            writeJsonString(f, __VERSION__);
+            std::fprintf(f, ",\n");
+#endif
+            std::fprintf(f, "    \"min_time_s\": %g\n  },\n  \"benchmarks\": [", opts.minTimeSec);
+
+            for (std::size_t i = 0; i < results.size(); ++i) {
+                const Result& r = results[i];
+                std::fprintf(f, "%s\n    {\"name\": ", i ? "," : "");
+                writeJsonString(f, r.name);
+                std::fprintf(f, ", \"param\": %zu, \"iterations\": %zu, \"ns_per_op\": %.4f, \"ns_per_item\": %.4f",
+                    r.param, r.iterations, r.nsPerOp, r.nsPerItem);
+                std::fprintf(f, ", \"counters\": {");
+                for (std::size_t c = 0; c < r.counters.size(); ++c) {
+                    std::fprintf(f, "%s", c ? ", " : "");
+                    writeJsonString(f, r.counters[c].first);
+                    std::fprintf(f, ": %.6g", r.counters[c].second);
+                }
+                std::fprintf(f, "}}");
+            }
+            std::fprintf(f, "\n  ]\n}\n");
+
+            // Un disco lleno o un archivo truncado deben hacer fallar la ejecución (y al CI)
+            if (f == stdout) return std::fflush(f) == 0 && !std::ferror(f);
+            const bool written = !std::ferror(f);
+            return std::fclose(f) == 0 && written;
+        }
+
+        // Ejecuta fn aumentando las iteraciones hasta que el bucle dure al menos minTimeSec.
+        State measure(BenchFn fn, std::size_t param, double minTimeSec) {
+            const double minNs = minTimeSec * 1e9;
+            std::size_t iters = 1;
+            for (;;) {
+                State st(param, iters);
+                fn(st);
+                if (st.elapsedNs() >= minNs || iters >= (std::size_t(1) << 32)) return st;
+
+                // Estima cuántas iteraciones faltan (con margen) sin crecer más de 10x por ronda
+                const double perIter = std::max(st.elapsedNs() / double(iters), 1.0);
+                const double wanted = minNs * 1.2 / perIter;
+                iters = std::size_t(std::min(wanted, double(iters) * 10.0)) + 1;
+            }
+        }
+    } // namespace
+
+    int runAll(int argc, char** argv) {
+        const Options opts = parseOptions(argc, argv);
+
+        // Con JSON a stdout la tabla va a stderr para no mezclar ambas salidas
+        std::FILE* table = (opts.jsonPath == "-") ? stderr : stdout;
+        std::vector<Result> results;
+
+        std::fprintf(table, "%-44s %14s %14s %14s\n", "Benchmark", "Iterations", "ns/op", "ns/item");
+        for (const Case& c : registry()) {
+            if (!opts.filter.empty() && c.name.find(opts.filter) == std::string::npos) continue;
+
+            for (std::size_t param : c.params) {
+                State st = measure(c.fn, param, opts.minTimeSec);
+                const double nsPerOp = st.elapsedNs() / double(st.iterations());
+                const double nsPerItem = nsPerOp / std::max(st.itemsPerIteration(), 1e-9);
+
+                const std::string label = c.name + "/" + std::to_string(param);
+                std::fprintf(table, "%-44s %14zu %14.2f %14.3f",
+                    label.c_str(), st.iterations(), nsPerOp, nsPerItem);
+                for (const auto& counter : st.counters()) {
+                    std::fprintf(table, "  %s=%.3f", counter.first.c_str(), counter.second);
+                }
+                std::fprintf(table, "\n");
+
+                results.push_back(Result{ c.name, param, st.iterations(), nsPerOp, nsPerItem, st.counters() });
+            }
+        }
+
+        if (!opts.jsonPath.empty() && !writeJson(opts.jsonPath, results, opts)) {
+            std::fprintf(stderr, "Cannot write JSON results to %s\n", opts.jsonPath.c_str());
+            return 1;
+        }
+        return 0;
+    }
+
+} // namespace Bench
+
+int main(int argc, char** argv) {
+    return Bench::runAll(argc, argv);
+}
@@ -0,0 +1,146 @@
+#include "Benchmark.h"
+
+#include "A_Racer.h"
+#include "RaceWorld.h"
+#include "ECS/Transform.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+/**
+ * @file BenchRacer.cpp
+ * @brief Coste por corredor de A_Racer::update (doPathFollowing + detección de meta) y de
+ * A_Racer::getProgress, barriendo el número de corredores y la longitud de la ruta; y coste de
+ * cambiar la ruta de todos los corredores con copias por corredor frente a una ruta compartida.
+ */
+
+namespace {
+
+    // Ruta cerrada circular de points puntos (radio fijo, como una pista de 1920x1080)
+    std::vector<sf::Vector2f> circlePath(std::size_t points) {
+        std::vector<sf::Vector2f> path;
+        path.reserve(points);
+        for (std::size_t i = 0; i < points; ++i) {
+            const float a = 6.2831853f * float(i) / float(points);
+            path.push_back({ 960.f + 450.f * std::cos(a), 540.f + 450.f * std::sin(a) });
+        }
+        return path;
+    }
+
+    // count corredores repartidos a lo largo de la ruta (no todos en el mismo waypoint)
+    std::vector<EngineUtilities::TSharedPointer<A_Racer>> makeRacers(std::size_t count,
+        const std::vector<sf::Vector2f>& path) {
+        std::vector<EngineUtilities::TSharedPointer<A_Racer>> racers;
+        racers.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            auto r = EngineUtilities::MakeShared<A_Racer>("Racer");
+            r->setPath(path);
+            r->setTotalLaps(1 << 30); // nunca terminan: siempre se ejecuta el path following
+            r->getComponentPtr<Transform>()->setPosition(path[(i * 7) % path.size()]);
+            racers.push_back(r);
+        }
+        // Calentamiento: que cada uno enganche su segmento antes de medir
+        for (int step = 0; step < 30; ++step)
+            for (auto& r : racers) r->update(1.f / 60.f);
+        return racers;
+    }
+
+    void runUpdate(Bench::State& state, std::size_t racerCount, std::size_t pathPoints) {
+        auto racers = makeRacers(racerCount, circlePath(pathPoints));
+        state.setItemsPerIteration(double(racerCount));
+        for (auto _ : state) {
+            for (auto& r : racers) r->update(1.f / 60.f);
+        }
+    }
+
+} // namespace
+
+// Parámetro: número de corredores (ruta de 256 puntos)
+static void BM_RacerUpdate(Bench::State& state) {
+    runUpdate(state, state.param(), 256);
+}
+G2D_BENCHMARK(BM_RacerUpdate, 4, 64, 1024, 8192);
+
+// Parámetro: puntos de la ruta (64 corredores)
+static void BM_RacerUpdate_PathLength(Bench::State& state) {
+    runUpdate(state, 64, state.param());
+}
+G2D_BENCHMARK(BM_RacerUpdate_PathLength, 16, 256, 4096);
+
+// Parámetro: número de corredores
+static void BM_RacerGetProgress(Bench::State& state) {
+    auto racers = makeRacers(state.param(), circlePath(256));
+    state.setItemsPerIteration(double(racers.size()));
+    for (auto _ : state) {
+        float sum = 0.f;
+        for (const auto& r : racers) sum += r->getProgress();
+        Bench::doNotOptimize(sum);
+    }
+}
+G2D_BENCHMARK(BM_RacerGetProgress, 4, 64, 1024);
+
+// Parámetro: puntos de control de la ruta (segmentos largos que densifyClosed subdivide)
+static void BM_DensifyClosed(Bench::State& state) {
+    const auto control = circlePath(state.param());
+    std::size_t produced = 0;
+    for (auto _ : state) {
+        auto dense = RaceWorld::densifyClosed(control, 4.f);
+        produced = dense.size();
+        Bench::doNotOptimize(dense.data());
+    }
+    state.setItemsPerIteration(double(produced));
+}
+G2D_BENCHMARK(BM_DensifyClosed, 8, 64, 512);
+
+// Parámetro: puntos de la ruta
+static void BM_OffsetClosed(Bench::State& state) {
+    const auto path = circlePath(state.param());
+    state.setItemsPerIteration(double(path.size()));
+    for (auto _ : state) {
+        auto lane = RaceWorld::offsetClosed(path, 12.f);
+        Bench::doNotOptimize(lane.data());
+    }
+}
+G2D_BENCHMARK(BM_OffsetClosed, 64, 1024, 16384);
+
+namespace {
+
+    constexpr float kLaneOffsets[] = { 0.f, +8.f, -8.f, +16.f };
+
+    // Bytes de puntos y longitudes acumuladas de una ruta de points puntos
+    double trackBytes(std::size_t points) {
+        return double(points) * double(sizeof(sf::Vector2f) + sizeof(float));
+    }
+
+} // namespace
+
+// Parámetro: número de corredores (ruta de 4096 puntos, 4 carriles). Cada corredor con su copia
+static void BM_PathSwap_PerRacerCopy(Bench::State& state) {
+    const auto path = circlePath(4096);
+    auto racers = makeRacers(state.param(), circlePath(16));
+    state.setItemsPerIteration(double(racers.size()));
+    for (auto _ : state) {
+        std::vector<std::vector<sf::Vector2f>> lanes;
+        for (float offset : kLaneOffsets) lanes.push_back(RaceWorld::offsetClosed(path, offset));
+        for (std::size_t i = 0; i < racers.size(); ++i) racers[i]->setPath(lanes[i % lanes.size()]);
+    }
+    state.setCounter("path_KiB_per_racer", trackBytes(path.size()) / 1024.0);
+}
+G2D_BENCHMARK(BM_PathSwap_PerRacerCopy, 4, 64, 1024);
+
+// Parámetro: número de corredores. Ruta compartida; cada carril se calcula una vez
+static void BM_PathSwap_Shared(Bench::State& state) {
+    const auto path = circlePath(4096);
+    auto racers = makeRacers(state.param(), circlePath(16));
+    state.setItemsPerIteration(double(racers.size()));
+    for (auto _ : state) {
+        const auto track = TrackPath::create(path);
+        for (std::size_t i = 0; i < racers.size(); ++i)
+            racers[i]->setTrack(track, kLaneOffsets[i % std::size(kLaneOffsets)]);
+    }
+    const double lanes = double(std::min<std::size_t>(racers.size(), std::size(kLaneOffsets)));
+    state.setCounter("path_KiB_per_racer", trackBytes(path.size()) * lanes / double(racers.size()) / 1024.0);
+}
+G2D_BENCHMARK(BM_PathSwap_Shared, 4, 64, 1024);
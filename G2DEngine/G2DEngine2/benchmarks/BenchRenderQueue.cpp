@@ -0,0 +1,82 @@
+#include "Benchmark.h"
+
+#include "RenderQueue.h"
+
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file BenchRenderQueue.cpp
+ * @brief Coste en CPU de encolar n comandos (4 capas, 8 texturas, en orden aleatorio) y ordenarlos
+ * por clave, como hace Window::flush() antes de dibujar. Las capas agrupan por textura
+ * (RenderSort::Texture); el contador texture_switches cuenta los cambios de textura tras ordenar,
+ * frente a los de dibujar en el orden de envío.
+ */
+
+namespace {
+
+    struct Command {
+        RenderLayer layer;
+        float depth;
+        int texture;
+    };
+
+    std::vector<Command> makeCommands(std::size_t count) {
+        std::vector<Command> commands(count);
+        std::uint32_t seed = 1234u;
+        for (std::size_t i = 0; i < count; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            commands[i].layer = RenderLayer((seed >> 8) % 4u);
+            commands[i].depth = float((seed >> 12) % 4u);
+            commands[i].texture = int((seed >> 20) % 8u);
+        }
+        return commands;
+    }
+
+    template<typename Range, typename TextureOf>
+    std::size_t countSwitches(const Range& range, TextureOf textureOf) {
+        std::size_t switches = 0;
+        const void* bound = nullptr;
+        for (const auto& item : range) {
+            const void* texture = textureOf(item);
+            if (texture != bound) {
+                ++switches;
+                bound = texture;
+            }
+        }
+        return switches;
+    }
+
+} // namespace
+
+// Parámetro: número de comandos por frame
+static void BM_RenderQueue_SubmitSort(Bench::State& state) {
+    const std::vector<Command> commands = makeCommands(state.param());
+    const std::array<sf::Texture, 8> textures{};
+    const std::array<sf::Vertex, 6> quad{};
+
+    RenderQueue queue;
+    for (int layer = 0; layer < 4; ++layer) queue.setSortMode(RenderLayer(layer), RenderSort::Texture);
+    std::size_t sortedSwitches = 0;
+    state.setItemsPerIteration(double(state.param()));
+    for (auto _ : state) {
+        queue.clear();
+        for (const Command& c : commands) {
+            queue.submit(c.layer, c.depth, quad.data(), quad.size(), sf::PrimitiveType::Triangles,
+                &textures[std::size_t(c.texture)]);
+        }
+        queue.sort();
+        Bench::doNotOptimize(queue.getCommands().data());
+    }
+    sortedSwitches = countSwitches(queue.getCommands(), [](const RenderCommand& c) { return c.texture; });
+
+    const std::size_t submitSwitches = countSwitches(commands,
+        [&](const Command& c) { return &textures[std::size_t(c.texture)]; });
+    state.setCounter("texture_switches", double(sortedSwitches));
+    state.setCounter("texture_switches_unsorted", double(submitSwitches));
+}
+G2D_BENCHMARK(BM_RenderQueue_SubmitSort, 100, 1000, 10000);
@@ -0,0 +1,34 @@
+#include "Benchmark.h"
+
+#include "ResourceManager.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * @file BenchResourceManager.cpp
+ * @brief Búsqueda de texturas con ResourceManager::getTexture con param texturas cargadas.
+ *
+ * Las rutas no existen: Texture solo avisa de que no pudo cargar, pero el componente queda
+ * registrado igual que en el juego, que es lo que mide la búsqueda.
+ */
+
+static void BM_ResourceManager_GetTexture(Bench::State& state) {
+    const std::size_t count = state.param();
+    ResourceManager manager;
+    std::vector<std::string> keys;
+    keys.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        keys.push_back("Sprites/BenchTexture_" + std::to_string(i));
+        manager.loadTexture(keys.back(), "png");
+    }
+
+    state.setItemsPerIteration(double(count));
+    for (auto _ : state) {
+        for (const auto& key : keys) {
+            auto tex = manager.getTexture(key);
+            Bench::doNotOptimize(tex.get());
+        }
+    }
+}
+G2D_BENCHMARK(BM_ResourceManager_GetTexture, 4, 64, 1024);
@@ -0,0 +1,114 @@
+#include "Benchmark.h"
+
+#include "Memory/TSharedPointer.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @file BenchSharedPointer.cpp
+ * @brief Coste de copiar/liberar, mover y convertir (static/dynamic) TSharedPointer con
+ * recuento no atómico y atómico, y prueba de estrés multihilo del recuento atómico.
+ */
+
+namespace {
+
+    struct Payload {
+        virtual ~Payload() = default;
+        int value = 42;
+    };
+
+    struct DerivedPayload : Payload {
+        float extra = 1.f;
+    };
+
+    // Copia y libera p n veces; el compilador no puede fusionar las copias por doNotOptimize.
+    template<typename Ptr>
+    void copyRelease(const Ptr& p, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            Ptr copy = p;
+            Bench::doNotOptimize(copy.get());
+        }
+    }
+
+} // namespace
+
+static void BM_SharedPtr_CopyRelease(Bench::State& state) {
+    auto p = EngineUtilities::MakeShared<Payload>();
+    for (auto _ : state) {
+        copyRelease(p, 1);
+    }
+}
+G2D_BENCHMARK(BM_SharedPtr_CopyRelease);
+
+static void BM_AtomicSharedPtr_CopyRelease(Bench::State& state) {
+    auto p = EngineUtilities::MakeAtomicShared<Payload>();
+    for (auto _ : state) {
+        copyRelease(p, 1);
+    }
+}
+G2D_BENCHMARK(BM_AtomicSharedPtr_CopyRelease);
+
+static void BM_SharedPtr_Move(Bench::State& state) {
+    auto a = EngineUtilities::MakeShared<Payload>();
+    EngineUtilities::TSharedPointer<Payload> b;
+    for (auto _ : state) {
+        b = std::move(a);
+        a = std::move(b);
+        Bench::doNotOptimize(a.get());
+    }
+}
+G2D_BENCHMARK(BM_SharedPtr_Move);
+
+static void BM_SharedPtr_StaticCast(Bench::State& state) {
+    EngineUtilities::TSharedPointer<Payload> base = EngineUtilities::MakeShared<DerivedPayload>();
+    for (auto _ : state) {
+        auto derived = base.static_pointer_cast<DerivedPayload>();
+        Bench::doNotOptimize(derived.get());
+    }
+}
+G2D_BENCHMARK(BM_SharedPtr_StaticCast);
+
+static void BM_SharedPtr_DynamicCast(Bench::State& state) {
+    EngineUtilities::TSharedPointer<Payload> base = EngineUtilities::MakeShared<DerivedPayload>();
+    for (auto _ : state) {
+        auto derived = base.dynamic_pointer_cast<DerivedPayload>();
+        Bench::doNotOptimize(derived.get());
+    }
+}
+G2D_BENCHMARK(BM_SharedPtr_DynamicCast);
+
+static void BM_AtomicSharedPtr_Contended(Bench::State& state) {
+    constexpr std::size_t kOpsPerThread = 100000;
+    const std::size_t threads = state.param();
+
+    auto shared = EngineUtilities::MakeAtomicShared<DerivedPayload>();
+    EngineUtilities::TAtomicSharedPointer<Payload> base = shared;
+    state.setItemsPerIteration(double(threads * kOpsPerThread));
+
+    for (auto _ : state) {
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (std::size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&base]() {
+                for (std::size_t i = 0; i < kOpsPerThread; ++i) {
+                    EngineUtilities::TAtomicSharedPointer<Payload> copy = base;
+                    auto derived = copy.static_pointer_cast<DerivedPayload>();
+                    Bench::doNotOptimize(derived.get());
+                }
+            });
+        }
+        for (auto& w : workers) w.join();
+    }
+
+    // Todas las copias de los hilos deben haberse liberado: quedan shared + base.
+    if (shared.useCount() != 2) {
+        std::fprintf(stderr, "BM_AtomicSharedPtr_Contended: useCount %d, expected 2\n",
+            shared.useCount());
+        std::abort();
+    }
+}
+G2D_BENCHMARK(BM_AtomicSharedPtr_Contended, 1, 2, 4, 8);
@@ -0,0 +1,106 @@
+#include "Benchmark.h"
+
+#include "SpatialHashGrid.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file BenchSpatialGrid.cpp
+ * @brief Consultas de proximidad entre n corredores repartidos por una pista de 1920x1080:
+ * reconstrucción de SpatialHashGrid, consultas por radio y k vecinos, y la búsqueda O(n^2)
+ * que haría falta sin rejilla.
+ */
+
+namespace {
+
+    constexpr float kRadius = 24.f;
+    constexpr std::size_t kNeighbours = 4;
+
+    // Corredores sobre un óvalo que ocupa la ventana, con una pista de ~60 px de ancho
+    struct Field {
+        std::vector<float> x, y;
+
+        explicit Field(std::size_t count) : x(count), y(count) {
+            std::uint32_t seed = 2024u;
+            auto next = [&seed] { seed = seed * 1664525u + 1013904223u; return float(seed >> 8) / 16777216.f; };
+            for (std::size_t i = 0; i < count; ++i) {
+                const float a = 6.2831853f * next();
+                const float lane = (next() - 0.5f) * 60.f;
+                x[i] = 960.f + (860.f + lane) * std::cos(a);
+                y[i] = 540.f + (460.f + lane) * std::sin(a);
+            }
+        }
+    };
+
+} // namespace
+
+// Parámetro: número de corredores
+static void BM_SpatialGrid_Build(Bench::State& state) {
+    const Field field(state.param());
+    SpatialHashGrid grid(kRadius);
+    state.setItemsPerIteration(double(state.param()));
+    for (auto _ : state) {
+        grid.build(field.x.data(), field.y.data(), field.x.size());
+        Bench::doNotOptimize(grid.size());
+    }
+}
+G2D_BENCHMARK(BM_SpatialGrid_Build, 100, 1000, 10000);
+
+// Parámetro: número de corredores. Una consulta por corredor (lo que hace la separación)
+static void BM_SpatialGrid_Radius(Bench::State& state) {
+    const Field field(state.param());
+    SpatialHashGrid grid(kRadius);
+    grid.build(field.x.data(), field.y.data(), field.x.size());
+
+    std::size_t found = 0, queries = 0;
+    state.setItemsPerIteration(double(state.param()));
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < field.x.size(); ++i) {
+            grid.forEachInRadius({ field.x[i], field.y[i] }, kRadius,
+                [&found](SpatialHashGrid::Index, float) { ++found; });
+        }
+        queries += field.x.size();
+    }
+    state.setCounter("neighbours", double(found) / double(queries ? queries : 1));
+}
+G2D_BENCHMARK(BM_SpatialGrid_Radius, 100, 1000, 10000);
+
+// Parámetro: número de corredores
+static void BM_SpatialGrid_NearestK(Bench::State& state) {
+    const Field field(state.param());
+    SpatialHashGrid grid(kRadius);
+    grid.build(field.x.data(), field.y.data(), field.x.size());
+
+    std::vector<SpatialHashGrid::Index> out;
+    out.reserve(kNeighbours);
+    state.setItemsPerIteration(double(state.param()));
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < field.x.size(); ++i) {
+            grid.nearestK({ field.x[i], field.y[i] }, kNeighbours, out, 1e9f, SpatialHashGrid::Index(i));
+            Bench::doNotOptimize(out.data());
+        }
+    }
+}
+G2D_BENCHMARK(BM_SpatialGrid_NearestK, 100, 1000, 10000);
+
+// Parámetro: número de corredores. Referencia: cada corredor contra todos los demás
+static void BM_SpatialGrid_BruteForceRadius(Bench::State& state) {
+    const Field field(state.param());
+    const float r2 = kRadius * kRadius;
+    const std::size_t n = field.x.size();
+
+    state.setItemsPerIteration(double(n));
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                const float dx = field.x[j] - field.x[i], dy = field.y[j] - field.y[i];
+                found += (dx * dx + dy * dy <= r2) ? 1 : 0;
+            }
+        }
+        Bench::doNotOptimize(found);
+    }
+}
+G2D_BENCHMARK(BM_SpatialGrid_BruteForceRadius, 100, 1000, 10000);
@@ -0,0 +1,60 @@
+#include "Benchmark.h"
+
+#include "SpriteBatch.h"
+
+#include <SFML/Graphics/Texture.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file BenchSpriteBatch.cpp
+ * @brief Coste en CPU de agrupar n sprites de corredores (4 texturas, como los karts del juego)
+ * en SpriteBatch: transformar las esquinas y llenar un arreglo de vértices por textura. El contador
+ * draw_calls compara los draws que emite flush() con los n que haría un draw por sprite.
+ */
+
+namespace {
+
+    struct Kart {
+        sf::Vector2f position;
+        float rotation;
+        int texture;
+    };
+
+    std::vector<Kart> makeKarts(std::size_t count) {
+        std::vector<Kart> karts(count);
+        std::uint32_t seed = 77u;
+        for (std::size_t i = 0; i < count; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            karts[i].position = { float(seed % 1920u), float((seed >> 11) % 1080u) };
+            karts[i].rotation = float((seed >> 20) % 360u);
+            karts[i].texture = int(i % 4);
+        }
+        return karts;
+    }
+
+} // namespace
+
+// Parámetro: número de sprites
+static void BM_SpriteBatch_Build(Bench::State& state) {
+    const std::vector<Kart> karts = makeKarts(state.param());
+    const std::array<sf::Texture, 4> textures{};
+    const sf::IntRect rect{ { 0, 0 }, { 64, 64 } };
+
+    SpriteBatch batch;
+    std::size_t draws = 0;
+    state.setItemsPerIteration(double(state.param()));
+    for (auto _ : state) {
+        batch.begin({ { 0.f, 0.f }, { 1920.f, 1080.f } });
+        for (const Kart& k : karts) {
+            batch.add(textures[std::size_t(k.texture)], rect, k.position, k.rotation, { 0.5f, 0.5f }, { 32.f, 32.f });
+        }
+        draws = batch.getBatchCount();
+        Bench::doNotOptimize(draws);
+    }
+    state.setCounter("draw_calls", double(draws));
+    state.setCounter("draw_calls_per_sprite", double(state.param()));
+}
+G2D_BENCHMARK(BM_SpriteBatch_Build, 100, 1000, 10000);
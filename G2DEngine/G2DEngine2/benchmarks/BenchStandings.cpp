@@ -0,0 +1,71 @@
+#include "Benchmark.h"
+
+#include "RaceStandings.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+/**
+ * @file BenchStandings.cpp
+ * @brief Clasificación de n corredores por paso: reparación incremental de RaceStandings frente
+ * a ordenar desde cero con std::sort (lo que hacía EngineGUI cada frame).
+ */
+
+namespace {
+
+    // Corredores en fila con velocidades algo distintas: cada paso solo hay unos pocos adelantamientos
+    struct Field {
+        std::vector<double> distance;
+        std::vector<double> speed;
+
+        explicit Field(std::size_t count) : distance(count), speed(count) {
+            std::uint32_t seed = 12345u;
+            for (std::size_t i = 0; i < count; ++i) {
+                seed = seed * 1664525u + 1013904223u;
+                distance[i] = double(count - i) * 2.0;
+                speed[i] = 140.0 + double(seed >> 24) * 0.05;
+            }
+        }
+
+        void step(double dt) {
+            for (std::size_t i = 0; i < distance.size(); ++i) distance[i] += speed[i] * dt;
+        }
+    };
+
+} // namespace
+
+// Parámetro: número de corredores
+static void BM_Standings_Incremental(Bench::State& state) {
+    Field field(state.param());
+    RaceStandings standings;
+    standings.reset(state.param());
+    standings.update([&](std::size_t i) { return field.distance[i]; });
+
+    std::size_t swaps = 0, steps = 0;
+    state.setItemsPerIteration(double(state.param()));
+    for (auto _ : state) {
+        field.step(1.0 / 60.0);
+        swaps += standings.update([&](std::size_t i) { return field.distance[i]; });
+        ++steps;
+    }
+    state.setCounter("swaps_per_step", double(swaps) / double(std::max<std::size_t>(steps, 1)));
+}
+G2D_BENCHMARK(BM_Standings_Incremental, 100, 1000, 10000);
+
+// Parámetro: número de corredores
+static void BM_Standings_FullSort(Bench::State& state) {
+    Field field(state.param());
+    std::vector<std::uint32_t> order(state.param());
+    std::iota(order.begin(), order.end(), 0u);
+
+    state.setItemsPerIteration(double(state.param()));
+    for (auto _ : state) {
+        field.step(1.0 / 60.0);
+        std::sort(order.begin(), order.end(),
+            [&](std::uint32_t a, std::uint32_t b) { return field.distance[a] > field.distance[b]; });
+        Bench::doNotOptimize(order.data());
+    }
+}
+G2D_BENCHMARK(BM_Standings_FullSort, 100, 1000, 10000);
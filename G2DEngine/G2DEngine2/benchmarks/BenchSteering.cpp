@@ -0,0 +1,101 @@
+#include "Benchmark.h"
+
+#include "SteeringBatch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * @file BenchSteering.cpp
+ * @brief Throughput del steering en lote: SteeringBatch::stepScalar frente a stepSimd, en
+ * corredores/ms. El caso SIMD también reporta la diferencia máxima con el escalar tras un paso.
+ */
+
+namespace {
+
+    // Ruta cerrada circular de points puntos, desplazada radialmente (un carril por offset)
+    std::vector<sf::Vector2f> circlePath(std::size_t points, float radius) {
+        std::vector<sf::Vector2f> path;
+        path.reserve(points);
+        for (std::size_t i = 0; i < points; ++i) {
+            const float a = 6.2831853f * float(i) / float(points);
+            path.push_back({ 960.f + radius * std::cos(a), 540.f + radius * std::sin(a) });
+        }
+        return path;
+    }
+
+    struct Track {
+        std::vector<std::vector<sf::Vector2f>> lanes;
+        Track() {
+            for (float radius : { 450.f, 458.f, 442.f, 466.f })
+                lanes.push_back(circlePath(256, radius));
+        }
+    };
+
+    // count corredores en cuatro carriles, repartidos a lo largo de la ruta y con parámetros distintos
+    SteeringBatch makeBatch(const Track& track, std::size_t count) {
+        SteeringBatch batch;
+        batch.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto& lane = track.lanes[i % track.lanes.size()];
+            const int wp = int((i * 7) % lane.size());
+            const SteeringBatch::Params params{ 120.f + float(i % 5) * 10.f, 140.f, 26.f };
+            batch.add(lane.data(), (int)lane.size(), wp, lane[wp] + sf::Vector2f{ 3.f, -2.f }, 0.f, params);
+        }
+        // Calentamiento: que cada uno enganche su segmento antes de medir
+        for (int step = 0; step < 30; ++step) batch.stepScalar(1.f / 60.f);
+        return batch;
+    }
+
+    void setRacersPerMs(Bench::State& state, std::size_t racerCount) {
+        const double ms = std::max(state.elapsedNs(), 1.0) * 1e-6;
+        state.setCounter("racers/ms", double(racerCount) * double(state.iterations()) / ms);
+    }
+
+    // Diferencia máxima entre un paso escalar y uno SIMD partiendo del mismo estado
+    void setMaxError(Bench::State& state, const SteeringBatch& start) {
+        SteeringBatch scalar = start, simd = start;
+        scalar.stepScalar(1.f / 60.f);
+        simd.stepSimd(1.f / 60.f);
+
+        float posErr = 0.f, rotErr = 0.f;
+        double waypointMismatches = 0.0;
+        for (std::size_t i = 0; i < scalar.size(); ++i) {
+            const sf::Vector2f d = scalar.getPosition(i) - simd.getPosition(i);
+            posErr = std::max({ posErr, std::abs(d.x), std::abs(d.y) });
+            rotErr = std::max(rotErr, std::abs(scalar.getRotation(i) - simd.getRotation(i)));
+            if (scalar.getWaypoint(i) != simd.getWaypoint(i)) waypointMismatches += 1.0;
+        }
+        state.setCounter("max_pos_err_px", posErr);
+        state.setCounter("max_rot_err_deg", rotErr);
+        state.setCounter("waypoint_mismatches", waypointMismatches);
+    }
+
+} // namespace
+
+// Parámetro: número de corredores
+static void BM_Steering_Scalar(Bench::State& state) {
+    static const Track track;
+    SteeringBatch batch = makeBatch(track, state.param());
+    state.setItemsPerIteration(double(batch.size()));
+    for (auto _ : state) {
+        batch.stepScalar(1.f / 60.f);
+    }
+    setRacersPerMs(state, batch.size());
+}
+G2D_BENCHMARK(BM_Steering_Scalar, 64, 1024, 8192, 65536);
+
+// Parámetro: número de corredores
+static void BM_Steering_Simd(Bench::State& state) {
+    static const Track track;
+    SteeringBatch batch = makeBatch(track, state.param());
+    setMaxError(state, batch);
+    state.setItemsPerIteration(double(batch.size()));
+    for (auto _ : state) {
+        batch.stepSimd(1.f / 60.f);
+    }
+    setRacersPerMs(state, batch.size());
+    state.setCounter("simd", SteeringBatch::hasSimd() ? 1.0 : 0.0);
+}
+G2D_BENCHMARK(BM_Steering_Simd, 64, 1024, 8192, 65536);
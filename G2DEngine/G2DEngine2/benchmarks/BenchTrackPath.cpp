@@ -0,0 +1,75 @@
+#include "Benchmark.h"
+
+#include "TrackPath.h"
+
+#include <cmath>
+#include <vector>
+
+/**
+ * @file BenchTrackPath.cpp
+ * @brief Consultas de TrackPath: pointAt (búsqueda binaria) y distanceAlong con y sin hint,
+ * barriendo el número de puntos de la ruta.
+ */
+
+namespace {
+
+    TrackPath circleTrack(std::size_t points) {
+        std::vector<sf::Vector2f> path;
+        path.reserve(points);
+        for (std::size_t i = 0; i < points; ++i) {
+            const float a = 6.2831853f * float(i) / float(points);
+            path.push_back({ 960.f + 450.f * std::cos(a), 540.f + 450.f * std::sin(a) });
+        }
+        return TrackPath(std::move(path));
+    }
+
+    constexpr int kQueries = 256;
+
+} // namespace
+
+// Parámetro: puntos de la ruta
+static void BM_TrackPath_PointAt(Bench::State& state) {
+    const TrackPath track = circleTrack(state.param());
+    const float step = track.totalLength() / float(kQueries);
+    state.setItemsPerIteration(kQueries);
+    for (auto _ : state) {
+        sf::Vector2f sum{};
+        for (int q = 0; q < kQueries; ++q) sum += track.pointAt(step * (float(q) + 0.37f));
+        Bench::doNotOptimize(sum);
+    }
+}
+G2D_BENCHMARK(BM_TrackPath_PointAt, 16, 256, 4096, 65536);
+
+// Parámetro: puntos de la ruta. Con hint (lo que hace A_Racer en cada paso)
+static void BM_TrackPath_DistanceAlong_Hint(Bench::State& state) {
+    const TrackPath track = circleTrack(state.param());
+    std::vector<sf::Vector2f> queries;
+    std::vector<int> hints;
+    for (int q = 0; q < kQueries; ++q) {
+        const float d = track.totalLength() * (float(q) + 0.37f) / float(kQueries);
+        queries.push_back(track.pointAt(d) + sf::Vector2f{ 4.f, -3.f });
+        hints.push_back(track.segmentAt(d));
+    }
+    state.setItemsPerIteration(kQueries);
+    for (auto _ : state) {
+        float sum = 0.f;
+        for (int q = 0; q < kQueries; ++q) sum += track.distanceAlong(queries[q], hints[q]);
+        Bench::doNotOptimize(sum);
+    }
+}
+G2D_BENCHMARK(BM_TrackPath_DistanceAlong_Hint, 16, 256, 4096, 65536);
+
+// Parámetro: puntos de la ruta. Sin hint: recorre la ruta completa
+static void BM_TrackPath_DistanceAlong_Scan(Bench::State& state) {
+    const TrackPath track = circleTrack(state.param());
+    std::vector<sf::Vector2f> queries;
+    for (int q = 0; q < 16; ++q)
+        queries.push_back(track.pointAt(track.totalLength() * (float(q) + 0.37f) / 16.f));
+    state.setItemsPerIteration(double(queries.size()));
+    for (auto _ : state) {
+        float sum = 0.f;
+        for (const auto& p : queries) sum += track.distanceAlong(p);
+        Bench::doNotOptimize(sum);
+    }
+}
+G2D_BENCHMARK(BM_TrackPath_DistanceAlong_Scan, 16, 256, 4096);
@@ -0,0 +1,111 @@
+#include "Benchmark.h"
+
+#include "ECS/Actor.h"
+#include "ECS/Transform.h"
+#include "ECS/TransformStore.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/**
+ * @file BenchTransformSync.cpp
+ * @brief Fase de update de N actores: mover cada transform y copiarlo a su forma.
+ *
+ * PerActor recorre los actores y, para cada uno, resuelve su Transform y sincroniza su
+ * shape (lo que hacía Actor::update en cada racer). Batched escribe directamente en los
+ * arreglos del TransformStore y copia todo en un solo TransformStore::syncDrawables().
+ * Idle mide un frame en el que nada se movió: todas las copias deben omitirse.
+ * Paused mide un frame en pausa con interpolación: alpha no cambia desde la pasada anterior,
+ * así que tampoco debe copiarse nada (aborta si alguna copia se hace).
+ */
+
+namespace {
+
+    constexpr float kStep = 0.5f;
+
+    std::vector<EngineUtilities::TSharedPointer<Actor>> makeActors(std::size_t count) {
+        std::vector<EngineUtilities::TSharedPointer<Actor>> actors;
+        actors.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            actors.push_back(EngineUtilities::MakeShared<Actor>("Racer"));
+            actors.back()->getComponentPtr<Transform>()->setPosition({ float(i % 1920), float(i / 1920) });
+        }
+        TransformStore::instance().syncDrawables();
+        return actors;
+    }
+
+} // namespace
+
+static void BM_UpdateTransforms_PerActor(Bench::State& state) {
+    auto actors = makeActors(state.param());
+    state.setItemsPerIteration(double(actors.size()));
+
+    for (auto _ : state) {
+        for (const auto& actor : actors) {
+            Transform* xf = actor->getComponentPtr<Transform>();
+            xf->setPosition(xf->getPosition() + sf::Vector2f{ kStep, 0.f });
+            actor->update(0.f);
+        }
+    }
+}
+G2D_BENCHMARK(BM_UpdateTransforms_PerActor, 100, 10000);
+
+static void BM_UpdateTransforms_Batched(Bench::State& state) {
+    auto actors = makeActors(state.param());
+    state.setItemsPerIteration(double(actors.size()));
+
+    std::vector<TransformStore::Index> indices;
+    indices.reserve(actors.size());
+    for (const auto& actor : actors) indices.push_back(actor->getComponentPtr<Transform>()->getStoreIndex());
+
+    TransformStore& store = TransformStore::instance();
+    for (auto _ : state) {
+        float* x = store.positionsX();
+        for (TransformStore::Index i : indices) {
+            x[i] += kStep;
+            store.markDirty(i);
+        }
+        Bench::doNotOptimize(store.syncDrawables());
+    }
+}
+G2D_BENCHMARK(BM_UpdateTransforms_Batched, 100, 10000);
+
+static void BM_SyncDrawables_Idle(Bench::State& state) {
+    auto actors = makeActors(state.param());
+    state.setItemsPerIteration(double(actors.size()));
+
+    TransformStore& store = TransformStore::instance();
+    for (auto _ : state) {
+        Bench::doNotOptimize(store.syncDrawables());
+    }
+    state.setCounter("synced", double(store.lastSyncStats().synced));
+    state.setCounter("skipped", double(store.lastSyncStats().skipped));
+}
+G2D_BENCHMARK(BM_SyncDrawables_Idle, 100, 10000);
+
+static void BM_SyncDrawables_Paused(Bench::State& state) {
+    auto actors = makeActors(state.param());
+    state.setItemsPerIteration(double(actors.size()));
+
+    // Último paso antes de pausar: todos se movieron desde el snapshot y se dibujan a mitad
+    TransformStore& store = TransformStore::instance();
+    store.snapshot();
+    for (const auto& actor : actors) {
+        Transform* xf = actor->getComponentPtr<Transform>();
+        xf->setPosition(xf->getPosition() + sf::Vector2f{ kStep, 0.f });
+    }
+    store.syncDrawables(0.5f);
+
+    for (auto _ : state) {
+        Bench::doNotOptimize(store.syncDrawables(0.5f));
+    }
+    if (store.lastSyncStats().synced != 0) {
+        std::fprintf(stderr, "BM_SyncDrawables_Paused: %zu transforms synced, expected 0\n",
+            store.lastSyncStats().synced);
+        std::abort();
+    }
+    state.setCounter("synced", double(store.lastSyncStats().synced));
+    state.setCounter("skipped", double(store.lastSyncStats().skipped));
+}
+G2D_BENCHMARK(BM_SyncDrawables_Paused, 100, 10000);
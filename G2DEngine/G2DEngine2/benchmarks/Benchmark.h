@@ -0,0 +1,157 @@
+#pragma once
+
+/**
+ * @file Benchmark.h
+ * @brief Arnés mínimo de microbenchmarks: registro de casos, bucle cronometrado y reporte.
+ *
+ * Uso:
+ * @code
+ * static void BM_Algo(Bench::State& state) {
+ *     // preparación (no se cronometra)
+ *     for (auto _ : state) { Bench::doNotOptimize(trabajo()); }
+ * }
+ * G2D_BENCHMARK(BM_Algo, 4, 64, 1024);
+ * @endcode
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <utility>
+
+namespace Bench {
+
+    /**
+     * @class State
+     * @brief Estado de una ejecución: parámetro del caso y número de iteraciones a cronometrar.
+     *
+     * El cronómetro arranca al comenzar el for-range sobre el State y se detiene al terminarlo,
+     * así la preparación previa al bucle no cuenta en el resultado.
+     */
+    class State {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        State(std::size_t param, std::size_t iterations)
+            : m_param(param), m_iterations(iterations) {
+        }
+
+        /** @brief Parámetro del caso (tamaño, número de elementos...). */
+        std::size_t param() const { return m_param; }
+
+        /** @brief Número de iteraciones que ejecuta el bucle cronometrado. */
+        std::size_t iterations() const { return m_iterations; }
+
+        /** @brief Elementos procesados por iteración (para reportar ns/elemento). */
+        void setItemsPerIteration(double items) { m_itemsPerIteration = items; }
+        double itemsPerIteration() const { return m_itemsPerIteration; }
+
+        /** @brief Añade una métrica extra al resultado (asignaciones, llamadas de dibujo...). */
+        void setCounter(const std::string& name, double value) {
+            for (auto& c : m_counters) {
+                if (c.first == name) { c.second = value; return; }
+            }
+            m_counters.emplace_back(name, value);
+        }
+        const std::vector<std::pair<std::string, double>>& counters() const { return m_counters; }
+
+        /** @brief Tiempo medido por el último bucle, en nanosegundos. */
+        double elapsedNs() const { return m_elapsedNs; }
+
+        /** @brief Valor del for-range; destructor no trivial para no disparar -Wunused-variable. */
+        struct Tick { ~Tick() {} };
+
+        struct Iterator {
+            State* state;
+            std::size_t remaining;
+
+            bool operator!=(const Iterator&) {
+                if (remaining != 0) return true;
+                state->stopTimer();
+                return false;
+            }
+            void operator++() { --remaining; }
+            Tick operator*() const { return Tick(); }
+        };
+
+        Iterator begin() {
+            m_start = Clock::now();
+            return Iterator{ this, m_iterations };
+        }
+        Iterator end() { return Iterator{ this, 0 }; }
+
+    private:
+        void stopTimer() {
+            m_elapsedNs = double(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                Clock::now() - m_start).count());
+        }
+
+        std::size_t m_param;
+        std::size_t m_iterations;
+        double m_itemsPerIteration = 1.0;
+        double m_elapsedNs = 0.0;
+        Clock::time_point m_start{};
+        std::vector<std::pair<std::string, double>> m_counters;
+    };
+
+    using BenchFn = void(*)(State&);
+
+    /**
+     * @brief Caso registrado: nombre, función y lista de parámetros a barrer.
+     */
+    struct Case {
+        std::string name;
+        BenchFn fn;
+        std::vector<std::size_t> params;
+    };
+
+    /** @brief Registro global de casos (orden de registro dentro de cada TU). */
+    inline std::vector<Case>& registry() {
+        static std::vector<Case> cases;
+        return cases;
+    }
+
+    /** @brief Registra un caso al construirse (se usa a través de G2D_BENCHMARK). */
+    struct Registrar {
+        Registrar(const char* name, BenchFn fn, std::initializer_list<std::size_t> params) {
+            registry().push_back(Case{ name, fn,
+                params.size() ? std::vector<std::size_t>(params) : std::vector<std::size_t>{ 0 } });
+        }
+    };
+
+    /**
+     * @brief Impide que el compilador elimine el cálculo que produce value.
+     */
+    template<typename T>
+    inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    /**
+     * @brief Ejecuta los casos registrados cuyo nombre contenga filter e imprime los resultados.
+     *
+     * Opciones: --filter <texto>, --min-time <segundos>, --json <archivo|-> (además de la tabla,
+     * escribe los resultados en JSON para comparar ejecuciones entre versiones).
+     * @return 0 si todo se ejecutó.
+     */
+    int runAll(int argc, char** argv);
+
+} // namespace Bench
+
+#define G2D_BENCHMARK_CONCAT_(a, b) a##b
+#define G2D_BENCHMARK_CONCAT(a, b) G2D_BENCHMARK_CONCAT_(a, b)
+
+/**
+ * @brief Registra fn como benchmark; los argumentos extra son los parámetros a barrer.
+ */
+#define G2D_BENCHMARK(fn, ...) \
+    static Bench::Registrar G2D_BENCHMARK_CONCAT(s_benchReg_, fn)(#fn, fn, { __VA_ARGS__ })
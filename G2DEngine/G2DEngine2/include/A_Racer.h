@@ -1,6 +1,8 @@
 #pragma once
 
 #include "ECS/Actor.h"
+#include "SteeringBatch.h"
+#include "TrackPath.h"
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <vector>
@@ -16,14 +18,20 @@ public:
 	void start() override {}                 // si no usas start, lo dejamos vaco
 	void update(float deltaTime) override;   // implementado en A_Racer.cpp
 
-	// Path a seguir (asgnalo desde BaseApp)
+	// Ruta compartida + carril (offset lateral); O(1) salvo la primera vez que se pide ese carril
+	void setTrack(const TrackPath::Ptr& track, float laneOffset = 0.f);
+
+	// Path propio (crea una ruta solo para este corredor; para varios corredores usa setTrack)
 	void setPath(const std::vector<sf::Vector2f>& pathPoints);
 
 	// Reinicia estado (vuelve al inicio del path)
 	void reset();
 
-	// Lnea de meta y vueltas
-	void setFinishLine(const sf::FloatRect& rect) { m_finishLine = rect; }
+	// Lnea de meta y vueltas. La vuelta cuenta cuando el segmento recorrido en el paso cruza,
+	// en el sentido del carril, la lnea que atraviesa la meta (no se la salta un paso largo).
+	// Si la meta est a menos de media vuelta por delante de la salida, el primer cruce es la
+	// salida y no cuenta; cruzarla hacia atrs obliga a volver a cruzarla hacia delante
+	void setFinishLine(const sf::FloatRect& rect);
 	void setTotalLaps(int laps) { m_totalLaps = laps; }
 	int  getCurrentLap() const { return m_currentLap; }
 	int  getTotalLaps()  const { return m_totalLaps; }
@@ -33,17 +41,51 @@ public:
 	void  setMaxSpeed(float s) { m_maxSpeed = s; }
 	float getMaxSpeed() const { return m_maxSpeed; }
 
+	// Distancia de anticipacin del pure pursuit (px): ms larga = trazada ms suave y ms recortada
+	void  setLookahead(float px) { lookaheadDistance = px; }
+	float getLookahead() const { return lookaheadDistance; }
+
 	// Podio / progreso
 	int   getPlace() const { return m_place; }
 	void  setPlace(int p) { m_place = p; }
-	float getProgress() const;   // 0..1 del loop actual (decl; impl en .cpp)
+	float getProgress() const;   // 0..1 del loop actual, por distancia recorrida (impl en .cpp)
+
+	// Ruta compartida, carril que se sigue y distancia recorrida sobre l en la vuelta actual
+	const TrackPath::Ptr& getSharedTrack() const { return m_sharedTrack; }
+	float getLaneOffset() const { return m_laneOffset; }
+	const TrackPath& getTrack() const { return *m_track; }
+	float getTrackDistance() const { return m_trackDistance; }
+
+	// Avance total en vueltas al trazado (vueltas completas + fraccin de la actual); comparable
+	// entre carriles de distinta longitud. Es la clave de RaceStandings para los que siguen corriendo
+	double getRaceProgress() const { return double(m_trackLaps) + double(getProgress()); }
+
+	// Steering en lote (RaceWorld + SteeringBatch): estado que se exporta y se devuelve
+	bool  isSteering() const { return !isFinished() && m_track->size() >= 2; }
+	const std::vector<sf::Vector2f>& getPath() const { return m_track->points(); }
+	int   getWaypointIndex() const { return currentWaypointIndex; }
+	SteeringBatch::Params getSteeringParams() const { return { m_maxSpeed, lookaheadDistance, arriveRadius }; }
+	void  applySteering(const sf::Vector2f& pos, float rotationDeg, int waypoint, bool moved);
+
+	// Cuenta vuelta si el ltimo movimiento cruz la meta hacia delante (update() la llama tras moverse)
+	void  updateLap();
+
+	// Fraccin (0..1) del ltimo movimiento en la que se cruz la meta; sirve para fechar la
+	// vuelta dentro del paso cuando updateLap() acaba de contarla
+	float getLapCrossFraction() const { return m_lapCrossFraction; }
 
 private:
 	void doPathFollowing(float deltaTime);   // steering hacia waypoints (impl en .cpp)
+	void updateFinishGate();                 // recalcula la lnea de meta segn el carril
+	void updateTrackDistance();              // reproyecta la posicin usando el waypoint como hint
 
 	// --- Ruta ---
-	std::vector<sf::Vector2f> path;
+	TrackPath::Ptr m_sharedTrack;                       // ruta base (compartida)
+	float m_laneOffset = 0.f;
+	const TrackPath* m_track = &TrackPath::emptyPath(); // carril de m_sharedTrack que se sigue
 	int   currentWaypointIndex = 0;
+	float m_trackDistance = 0.f;   // distancia desde path.front() a lo largo de la ruta
+	int   m_trackLaps = 0;         // veces que se pas por path.front() (independiente de la meta)
 
 	// --- Parmetros de steering ---
 	float lookaheadDistance = 140.f;   // pure pursuit
@@ -52,9 +94,13 @@ private:
 
 	// --- Meta / vueltas ---
 	sf::FloatRect m_finishLine{};
+	sf::Vector2f m_gateOrigin{};            // lnea de meta: un punto y su normal (unitaria,
+	sf::Vector2f m_gateForward{ 1.f, 0.f }; // en el sentido del carril)
+	sf::Vector2f m_lapPrevPos{};     // posicin en la ltima updateLap()
+	float m_lapCrossFraction = 1.f;  // fraccin del ltimo movimiento en la que cruz la meta
+	int  m_gateDebt = 0;             // cruces hacia delante que no cuentan (salida, marcha atrs)
 	int  m_currentLap = 0;
 	int  m_totalLaps = 3;
-	bool m_crossedLastFrame = false;
 
 	// --- Estado de carrera ---
 	int  m_place = 0;        // 0 = corriendo; 1..N = posicin final
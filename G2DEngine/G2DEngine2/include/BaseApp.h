@@ -8,6 +8,12 @@
 #include <ECS/Transform.h>
 #include <ECS/Actor.h>
 #include <A_Racer.h>
+#include <RaceWorld.h>
+#include <FixedTimestep.h>
+#include <SpriteBatch.h>
+#include <DebugGeometry.h>
+#include <StaticLayer.h>
+#include <RenderQueue.h>
 
 #include <vector>
 #include <SFML/System.hpp>
@@ -35,6 +41,19 @@ public:
      */
     int run();
 
+    /**
+     * @brief Ejecuta un frame completo: eventos, lógica, GUI y render.
+     *
+     * run() la llama mientras la ventana esté abierta; herramientas como FrameAllocCheck
+     * la invocan directamente tras init() para controlar el número de frames.
+     */
+    void runFrame();
+
+    /**
+     * @brief Indica si la ventana sigue abierta (la aplicación debe seguir corriendo).
+     */
+    bool isRunning() const { return !m_windowPtr.isNull() && m_windowPtr->isOpen(); }
+
     /**
      * @brief Inicializa la ventana, recursos y elementos del juego.
      * @return true si la inicialización fue exitosa, false en caso contrario.
@@ -57,14 +76,23 @@ public:
     void destroy() {}
 
 private:
+    /**
+     * @brief Cierra, densifica y aplica a los corredores la ruta dibujada en modo edición.
+     */
+    void finalizePath();
+
     EngineUtilities::TSharedPointer<Window> m_windowPtr;
     EngineUtilities::TSharedPointer<Actor> m_trackActor;
-    std::vector<EngineUtilities::TSharedPointer<A_Racer>> m_racers;
-    std::vector<EngineUtilities::TSharedPointer<A_Racer>> m_finishedOrder;
     ResourceManager resourceMan;
     EngineGUI gui;
-    std::vector<sf::Vector2f> m_path;
-    sf::FloatRect m_finishLine;
-    float m_raceTimer = 0.f;
+    RaceWorld m_race; ///< Ruta, corredores, meta y clasificación.
+    FixedTimestep m_timestep; ///< Paso fijo de la simulación (Hz y substeps desde la GUI).
+    SpriteBatch m_spriteBatch; ///< Sprites de los corredores agrupados por textura (un draw por textura).
+    DebugGeometry m_pathGeometry; ///< Ruta activa (línea + puntos), se regenera al cambiar la ruta.
+    StaticLayer m_staticLayer; ///< Pista y ruta activa horneadas en una RenderTexture.
+    RenderQueue m_renderQueue; ///< Draws del frame; Window::flush() los ordena y los dibuja.
+    DebugGeometry m_editGeometry; ///< Ruta en edición.
+    DebugGeometry m_racerDots{ sf::VertexBuffer::Usage::Stream }; ///< Posición real de cada corredor.
+    std::vector<sf::Vector2f> m_racerDotCenters; ///< Reutilizado cada frame para no asignar.
     bool m_raceStarted = false;
 };
\ No newline at end of file
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <RaceWorld.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class BatchRunner
+ * @brief Corre miles de carreras headless con parámetros aleatorios repartidas entre todos los
+ * núcleos y guarda el resultado de cada corredor en un CSV o en un archivo binario.
+ *
+ * Cada carrera es un RaceWorld independiente (ruta, corredores y meta propios) que se construye,
+ * simula y destruye dentro de un mismo hilo del pool. Los parámetros de cada corredor (velocidad
+ * máxima, lookahead y carril) salen de un generador sembrado con (seed, número de carrera), y los
+ * resultados se escriben en orden de carrera: el archivo es idéntico con cualquier --threads.
+ *
+ * Uso: G2DEngine2 --batch [--races N] [--laps N] [--threads N] [--seed N] [--dt S]
+ *                         [--max-time S] [--out FILE] [--format csv|bin]
+ *                         [--steering batched|per-racer]
+ *
+ * CSV: una fila por corredor con race, seed, racer, place (0 = no terminó), finish_time,
+ * max_speed, lookahead, lane_offset y lap1..lapN (duración de cada vuelta).
+ *
+ * Binario (little-endian): cabecera { char magic[4] = "G2DB"; uint32 version = 1; uint32 races;
+ * uint32 racersPerRace; uint32 laps; uint64 seed; } y después races * racersPerRace registros
+ * { uint32 race; uint32 racer; int32 place; float finishTime; float maxSpeed; float lookahead;
+ * float laneOffset; float lapTimes[laps]; }. Los tiempos que no existen (DNF) valen -1.
+ */
+class BatchRunner {
+public:
+    /**
+     * @brief Formato del archivo de resultados.
+     */
+    enum class Format {
+        Csv,
+        Binary
+    };
+
+    /**
+     * @brief Opciones de la ejecución.
+     */
+    struct Options {
+        int races = 1000;              ///< Carreras a simular
+        int laps = 3;                  ///< Vueltas por carrera
+        int threads = 0;               ///< Hilos del pool (0 = núcleos disponibles)
+        std::uint64_t seed = 1;        ///< Semilla base; la de cada carrera se deriva de ella
+        float dt = 1.f / 60.f;         ///< Paso fijo de simulación, en segundos
+        float maxRaceTime = 600.f;     ///< Tiempo simulado máximo por carrera
+        std::string output = "race_results.csv";
+        Format format = Format::Csv;
+        RaceWorld::SteeringMode steering = RaceWorld::SteeringMode::Batched;
+
+        // Rangos de los parámetros aleatorios (uniformes)
+        float minSpeed = 110.f, maxSpeed = 170.f;          ///< px/s
+        float minLookahead = 90.f, maxLookahead = 190.f;   ///< px
+        float maxLaneOffset = 20.f;                        ///< Carril en [-max, +max] px
+    };
+
+    /**
+     * @brief Parámetros y resultado de un corredor en una carrera.
+     */
+    struct RacerResult {
+        std::string name;
+        float maxSpeed = 0.f;
+        float lookahead = 0.f;
+        float laneOffset = 0.f;
+        int place = 0;               ///< 0 si no terminó antes de maxRaceTime
+        float finishTime = -1.f;     ///< Tiempo de carrera al terminar; -1 si no terminó
+        std::vector<float> lapTimes; ///< Duración de cada vuelta completada
+    };
+
+    /**
+     * @brief Resultado de una carrera (corredores en el orden de RaceWorld::getRacers()).
+     */
+    struct RaceResult {
+        std::uint64_t seed = 0;
+        bool finished = false;
+        std::vector<RacerResult> racers;
+    };
+
+    /**
+     * @brief Lee las opciones de la línea de comandos (ignora las que no conoce).
+     */
+    static Options parseOptions(int argc, char** argv);
+
+    /**
+     * @brief Indica si la línea de comandos pide el modo batch (--batch).
+     */
+    static bool isRequested(int argc, char** argv);
+
+    /**
+     * @brief Semilla de la carrera race (splitmix64 de la semilla base y el índice).
+     */
+    static std::uint64_t raceSeed(std::uint64_t baseSeed, int race);
+
+    explicit BatchRunner(const Options& options) : m_options(options) {}
+
+    /**
+     * @brief Simula todas las carreras, escribe el archivo e imprime un resumen.
+     * @return 0 si todo fue bien, 1 si alguna carrera llegó a maxRaceTime, 2 si no se pudo escribir.
+     */
+    int run();
+
+    /**
+     * @brief Simula una carrera completa. Solo depende de las opciones y de seed, no del hilo.
+     */
+    RaceResult runRace(std::uint64_t seed) const;
+
+    /** @brief Resultados de la última run(), en orden de carrera. */
+    const std::vector<RaceResult>& getResults() const { return m_results; }
+
+private:
+    int resolveThreadCount() const;
+    bool writeCsv(const std::string& path) const;
+    bool writeBinary(const std::string& path) const;
+
+    Options m_options;
+    std::vector<RaceResult> m_results;
+};
@@ -10,8 +10,10 @@
 #include <Memory/TSharedPointer.h>
 #include <ECS/Component.h>
 #include <ECS/Texture.h>
+#include <cstdint>
 
 class Window;
+class TransformStore;
 
 /**
  * @class CShape
@@ -19,6 +21,12 @@ class Window;
  */
 class CShape : public Component {
 public:
+	/**
+	 * @brief Type used by Actor to resolve this component through its slot table.
+	 */
+	static constexpr ComponentType StaticType = ComponentType::SHAPE;
+	using StaticTypeOwner = CShape;
+
 	/**
 	 * @brief Default constructor. Shape is initially empty (no geometry).
 	 */
@@ -31,9 +39,9 @@ public:
 	explicit CShape(ShapeType shapeType);
 
 	/**
-	 * @brief Virtual destructor.
+	 * @brief Virtual destructor. Unbinds the shape from its Transform if it is still bound.
 	 */
-	~CShape() override = default;
+	~CShape() override;
 
 	/**
 	 * @brief Called once when the component starts.
@@ -52,6 +60,17 @@ public:
 	 */
 	void render(const EngineUtilities::TSharedPointer<Window>& window) override;
 
+	/**
+	 * @brief Draws the shape into any SFML render target (e.g. a RenderTexture layer).
+	 * @param target Target to draw into. Does nothing if the shape was not created.
+	 */
+	void renderTo(sf::RenderTarget& target) const;
+
+	/**
+	 * @brief Queues the shape in the frame render queue (does nothing if not created).
+	 */
+	void submit(RenderQueue& queue, RenderLayer layer, float depth) const override;
+
 	/**
 	 * @brief Releases resources owned by this component.
 	 */
@@ -65,6 +84,10 @@ public:
 
 	/**
 	 * @brief Sets the world position of the shape.
+	 *
+	 * While the shape is bound to a Transform (see Actor::bindDrawables) the Transform owns
+	 * position, rotation and scale, so this and setRotation()/setScale() write to the Transform
+	 * instead; otherwise the next transform sync would overwrite the value.
 	 * @param x X coordinate.
 	 * @param y Y coordinate.
 	 */
@@ -106,7 +129,32 @@ public:
 	 */
 	void setTexture(const EngineUtilities::TSharedPointer<Texture>& texture);
 
+	/**
+	 * @brief Change counter; advances every time the shape's state is modified.
+	 *
+	 * TransformStore compares it to decide whether the owning Transform must be re-applied.
+	 * @return Current version of this shape.
+	 */
+	std::uint32_t getVersion() const { return m_version; }
+
+	/**
+	 * @brief Per-thread counter that advances whenever a CShape changes on this thread.
+	 *
+	 * Lets the batched transform sync skip per-shape version checks on frames where
+	 * no shape was touched. It is thread_local like TransformStore::instance(): shapes are
+	 * created, modified and synced on the thread that owns their world.
+	 * @return Current change epoch of the calling thread.
+	 */
+	static std::uint32_t changeEpoch() { return s_changeEpoch; }
+
 private:
+	friend class TransformStore;
+
+	/**
+	 * @brief Bumps this shape's version and the global change epoch.
+	 */
+	void markChanged() { ++m_version; ++s_changeEpoch; }
+
 	/**
 	 * @brief Owned pointer to the underlying SFML shape instance.
 	 */
@@ -116,4 +164,20 @@ private:
 	 * @brief Current primitive type represented by this component.
 	 */
 	ShapeType m_shapeType = ShapeType::EMPTY;
+
+	/**
+	 * @brief Version of this shape's state (see getVersion()).
+	 */
+	std::uint32_t m_version = 0;
+
+	/**
+	 * @brief Store and index of the Transform this shape is bound to (set by TransformStore::bind).
+	 */
+	TransformStore* m_boundStore = nullptr;
+	std::uint32_t m_boundIndex = 0;
+
+	/**
+	 * @brief Change epoch of the current thread (see changeEpoch()).
+	 */
+	static inline thread_local std::uint32_t s_changeEpoch = 0;
 };
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+/**
+ * @file DebugGeometry.h
+ * @brief Geometría de depuración (rutas y marcadores) que solo se reconstruye cuando cambia.
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "RenderQueue.h"
+
+namespace sf {
+    class RenderTarget;
+}
+
+class Window;
+
+/**
+ * @class DebugGeometry
+ * @brief Guarda en un solo arreglo de triángulos una polilínea cerrada con un disco en cada
+ * punto, o solo discos, y la dibuja con un draw.
+ *
+ * setClosedPath()/setDiscs() comparan la entrada con la del último build y, si no cambió, no tocan
+ * los vértices. La línea se genera como quads finos para compartir primitiva con los discos. Si el
+ * driver tiene vertex buffers, los vértices viven en la GPU y solo se suben al reconstruir.
+ */
+class DebugGeometry {
+public:
+    /**
+     * @param usage Static para geometría que cambia poco (rutas), Stream para la que cambia casi
+     *        cada frame (posiciones de los corredores).
+     */
+    explicit DebugGeometry(sf::VertexBuffer::Usage usage = sf::VertexBuffer::Usage::Static);
+
+    /**
+     * @brief Polilínea cerrada por points con un disco en cada punto.
+     * @return true si hubo que reconstruir.
+     */
+    bool setClosedPath(const std::vector<sf::Vector2f>& points, sf::Color color,
+        float markerRadius = 3.f, float lineWidth = 1.5f);
+
+    /**
+     * @brief Un disco por centro, sin línea.
+     * @return true si hubo que reconstruir.
+     */
+    bool setDiscs(const std::vector<sf::Vector2f>& centers, sf::Color color, float radius);
+
+    /** @brief Vacía la geometría (draw() no dibuja nada). */
+    void clear();
+
+    /** @brief Dibuja todo con una sola llamada a Window::draw(). */
+    void draw(Window& window) const;
+
+    /** @brief Igual que draw(), sobre cualquier RenderTarget (p. ej. la capa de StaticLayer). */
+    void drawTo(sf::RenderTarget& target) const;
+
+    /** @brief Encola la geometría como un solo comando (sin textura). */
+    void submit(RenderQueue& queue, RenderLayer layer, float depth) const;
+
+    std::size_t getVertexCount() const { return m_vertices.size(); }
+
+    /**
+     * @brief Veces que cambiaron los vértices (rebuilds y clear()). Sirve para comprobar que la
+     * caché funciona y para que StaticLayer sepa cuándo volver a hornear.
+     */
+    std::size_t getRebuildCount() const { return m_rebuilds; }
+
+private:
+    enum class Kind { None, ClosedPath, Discs };
+
+    bool isUpToDate(Kind kind, const std::vector<sf::Vector2f>& points, sf::Color color,
+        float radius, float lineWidth) const;
+    void upload();
+
+    // Entrada del último build (la clave de la caché)
+    Kind m_kind = Kind::None;
+    std::vector<sf::Vector2f> m_points;
+    sf::Color m_color;
+    float m_radius = 0.f;
+    float m_lineWidth = 0.f;
+
+    std::vector<sf::Vertex> m_vertices;   ///< Triángulos; también respaldo si no hay vertex buffers
+    sf::VertexBuffer m_buffer;
+    bool m_useBuffer = false;
+    std::size_t m_rebuilds = 0;
+};
@@ -7,6 +7,7 @@
 
 #include <string>
 #include <vector>
+#include <array>
 #include <type_traits>
 
 #include "Prerequisites.h"
@@ -15,8 +16,24 @@
 #include "CShape.h"
 #include "ECS/Transform.h"
 #include "ECS/Texture.h"
+#include "RenderQueue.h"
 
 class Window;
+class SpriteBatch;
+
+/**
+ * @brief Indica si T declara él mismo `StaticType` y `StaticTypeOwner` (resolución por slot).
+ *
+ * Un tipo derivado de Transform, CShape o Texture hereda ambos miembros, pero su StaticTypeOwner
+ * sigue siendo la base; así no se resuelve por slot (que podría guardar la base, y el static_cast
+ * sería UB) y cae en la búsqueda con dynamic_cast.
+ */
+template<typename T, typename = void>
+struct HasStaticComponentType : std::false_type {};
+
+template<typename T>
+struct HasStaticComponentType<T, std::void_t<decltype(T::StaticType), typename T::StaticTypeOwner>>
+    : std::is_same<typename T::StaticTypeOwner, T> {};
 
 /**
  * @class Actor
@@ -31,15 +48,15 @@ public:
     explicit Actor(const std::string& name)
         : m_name(name)
     {
-        // Componentes base por defecto: shape y transform
-        addComponent(EngineUtilities::MakeShared<CShape>());
-        addComponent(EngineUtilities::MakeShared<Transform>());
+        // Componentes base por defecto: shape y transform (desde el pool de cada tipo)
+        addComponent(EngineUtilities::MakePooled<CShape>());
+        addComponent(EngineUtilities::MakePooled<Transform>());
     }
 
     /**
-     * @brief Destructor virtual por defecto.
+     * @brief Destructor virtual; desenlaza sus drawables del TransformStore.
      */
-    virtual ~Actor() = default;
+    virtual ~Actor();
 
     /**
      * @brief Hook de inicio; se llama una vez cuando el actor se inicializa.
@@ -48,6 +65,10 @@ public:
 
     /**
      * @brief Actualiza la lógica del actor cada frame.
+     *
+     * La copia Transform -> shape/sprite no se hace aquí por actor sino en lote con
+     * TransformStore::syncDrawables(); esta versión base solo fuerza la de este actor
+     * (útil tras teletransportarlo fuera del bucle de frame).
      * @param deltaTime Tiempo transcurrido desde el último frame, en segundos.
      */
     virtual void update(float deltaTime);
@@ -58,6 +79,27 @@ public:
      */
     virtual void render(const EngineUtilities::TSharedPointer<Window>& window);
 
+    /**
+     * @brief Como render(), pero los sprites se añaden al lote de su textura en lugar de
+     * dibujarse uno a uno; el llamador dibuja todos los lotes con SpriteBatch::flush().
+     * @param batch Lote del frame.
+     */
+    virtual void renderBatched(SpriteBatch& batch);
+
+    /**
+     * @brief Como render(), pero sobre cualquier RenderTarget de SFML (p. ej. la RenderTexture
+     * de StaticLayer). No pasa por Window, así que no cuenta en Window::getDrawCalls().
+     * @param target Destino del dibujo.
+     */
+    virtual void renderTo(sf::RenderTarget& target);
+
+    /**
+     * @brief Encola el dibujo del actor en la capa y profundidad del actor; Window::flush() lo
+     * dibuja ordenado con el resto del frame.
+     * @param queue Cola de render del frame.
+     */
+    virtual void submit(RenderQueue& queue);
+
     /**
      * @brief Libera recursos asociados al actor (si aplica).
      */
@@ -87,23 +129,70 @@ public:
      */
     int getPlayerId() const { return m_playerId; }
 
+    /**
+     * @brief Capa y profundidad con las que submit() encola el actor (menor profundidad = antes).
+     */
+    void setRenderLayer(RenderLayer layer, float depth = 0.f) { m_renderLayer = layer; m_renderDepth = depth; }
+    RenderLayer getRenderLayer() const { return m_renderLayer; }
+    float getRenderDepth() const { return m_renderDepth; }
+
+    /**
+     * @brief Si es true, setTexture() usa la textura como relleno de la CShape y el actor se dibuja
+     * con la shape (la pista); si es false (por defecto) se dibuja el sprite de la textura.
+     */
+    void setTextureFillsShape(bool fills) { m_textureFillsShape = fills; }
+    bool getTextureFillsShape() const { return m_textureFillsShape; }
+
     /**
      * @brief Busca y devuelve el primer componente del tipo solicitado.
+     *
+     * Si HasStaticComponentType<T> se cumple se resuelve con un acceso indexado a la tabla de slots;
+     * en otro caso se recorre la lista con dynamic_pointer_cast.
      * @tparam T Tipo de componente derivado de Component.
      * @return Shared pointer al componente encontrado o nulo si no existe.
      */
     template<typename T>
     EngineUtilities::TSharedPointer<T> getComponent() const {
-        for (const auto& comp : components) {
-            if (auto casted = comp.template dynamic_pointer_cast<T>()) {
-                return casted;
+        if constexpr (HasStaticComponentType<T>::value) {
+            return m_slots[T::StaticType].template static_pointer_cast<T>();
+        }
+        else {
+            for (const auto& comp : components) {
+                if (auto casted = comp.template dynamic_pointer_cast<T>()) {
+                    return casted;
+                }
             }
+            return EngineUtilities::TSharedPointer<T>();
+        }
+    }
+
+    /**
+     * @brief Versión no propietaria de getComponent para rutas calientes (sin tocar el refcount).
+     * @tparam T Tipo de componente derivado de Component.
+     * @return Puntero crudo al componente o nullptr si no existe; válido mientras viva el actor.
+     */
+    template<typename T>
+    T* getComponentPtr() const {
+        if constexpr (HasStaticComponentType<T>::value) {
+            return static_cast<T*>(m_slots[T::StaticType].get());
+        }
+        else {
+            for (const auto& comp : components) {
+                if (T* casted = dynamic_cast<T*>(comp.get())) {
+                    return casted;
+                }
+            }
+            return nullptr;
         }
-        return EngineUtilities::TSharedPointer<T>();
     }
 
     /**
      * @brief Añade un componente al actor.
+     *
+     * El primer componente de cada ComponentType ocupa su slot, igual que getComponent
+     * devolvía el primero encontrado al recorrer la lista, pero solo si su tipo dinámico es el
+     * dueño del slot (Transform, CShape o Texture): un componente cualquiera que diga ser TEXTURE
+     * va solo a la lista, porque getComponentPtr<Texture>() hace static_cast sobre el slot.
      * @tparam T Tipo del componente (debe derivar de Component).
      * @param component Shared pointer al componente a agregar.
      */
@@ -112,9 +201,22 @@ public:
         static_assert(std::is_base_of<Component, T>::value,
             "addComponent<T> sólo acepta Component derivados");
         EngineUtilities::TSharedPointer<Component> baseComp = component;
+        const ComponentType type = baseComp ? baseComp->getType() : ComponentType::None;
+        if (type != ComponentType::None && m_slots[type].isNull() && fitsSlot(*baseComp, type)) {
+            m_slots[type] = baseComp;
+            bindDrawables();
+        }
         components.push_back(baseComp);
     }
 
+    /**
+     * @brief Lista completa de componentes en orden de inserción.
+     * @return Referencia constante al vector de componentes.
+     */
+    const std::vector<EngineUtilities::TSharedPointer<Component>>& getComponents() const {
+        return components;
+    }
+
     /**
      * @brief Asigna una textura (componente Texture) al actor.
      * @param texture Componente de textura que envuelve un sf::Texture.
@@ -122,12 +224,34 @@ public:
     void setTexture(const EngineUtilities::TSharedPointer<Texture>& texture);
 
 private:
+    /**
+     * @brief Enlaza la forma y el sprite actuales con el Transform para la sincronización en lote.
+     */
+    void bindDrawables();
+
+    /**
+     * @brief true si component es del tipo dueño del slot type (comprobado con dynamic_cast).
+     * Los tipos sin dueño (sin StaticType) no usan slot.
+     */
+    static bool fitsSlot(const Component& component, ComponentType type);
+
     /** @brief Nombre del actor. */
     std::string m_name;
 
     /** @brief Lista de componentes que posee el actor. */
     std::vector<EngineUtilities::TSharedPointer<Component>> components;
 
+    /** @brief Primer componente de cada ComponentType, indexado por tipo (None queda vacío). */
+    std::array<EngineUtilities::TSharedPointer<Component>,
+        ComponentType::COMPONENT_TYPE_COUNT> m_slots;
+
     /** @brief Identificador de jugador (para UI/controles); 0 si no aplica. */
     int m_playerId = 0;
+
+    /** @brief Capa y profundidad en la cola de render. */
+    RenderLayer m_renderLayer = RenderLayer::Sprites;
+    float m_renderDepth = 0.f;
+
+    /** @brief Dibuja la shape rellena con la textura en lugar del sprite. */
+    bool m_textureFillsShape = false;
 };
\ No newline at end of file
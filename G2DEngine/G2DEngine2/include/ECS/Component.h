@@ -6,9 +6,14 @@
  */
 
 #include <Prerequisites.h>
+#include <cstdint>
 
 class
     Window;
+class
+    RenderQueue;
+enum class
+    RenderLayer : std::uint8_t;
 
 /**
  * @enum ComponentType
@@ -23,7 +28,8 @@ enum
     PHYSICS = 4,    ///< Physics simulation component
     AUDIOSOURCE = 5,///< Audio source component
     SHAPE = 6,      ///< Shape component (geometry-based)
-    TEXTURE = 7     ///< Texture component (for applying textures)
+    TEXTURE = 7,    ///< Texture component (for applying textures)
+    COMPONENT_TYPE_COUNT = 8 ///< Number of types; size of per-type slot tables
 };
 
 /**
@@ -32,6 +38,11 @@ enum
  *
  * Components represent behavior or data associated with game objects. This class provides
  * virtual methods that must be overridden by derived components to define behavior.
+ *
+ * Derived components may declare `static constexpr ComponentType StaticType` together with
+ * `using StaticTypeOwner = <the class itself>;` so that Actor can resolve them through its
+ * per-type slot table instead of scanning. Subclasses inherit both members, so the owner alias
+ * tells Actor they are not the slot's exact type and must be looked up with dynamic_cast.
  */
 class
     Component {
@@ -74,6 +85,20 @@ public:
     virtual void
         render(const EngineUtilities::TSharedPointer<Window>& window) = 0;
 
+    /**
+     * @brief Queues this component's draw instead of drawing it immediately.
+     *
+     * The default does nothing; drawable components override it. The queued drawable must stay
+     * alive until Window::flush().
+     * @param queue Frame render queue.
+     * @param layer Layer chosen by the owning actor.
+     * @param depth Depth inside the layer (lower draws first).
+     */
+    virtual void
+        submit(RenderQueue& queue, RenderLayer layer, float depth) const {
+        (void)queue; (void)layer; (void)depth;
+    }
+
     /**
      * @brief Pure virtual method for cleaning up resources.
      */
@@ -88,5 +113,5 @@ public:
         getType() const { return m_type; }
 
 protected:
-    ComponentType m_type; ///< The specific type of the component.
+    ComponentType m_type = ComponentType::None; ///< The specific type of the component.
 };
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include <SFML/Graphics.hpp> // Sprite, Texture, Angle, etc.
 
 class Window;
+class SpriteBatch;
 
 /**
  * @class Texture
@@ -20,10 +21,20 @@ class Window;
  *
  * Carga desde: bin/<textureName>.<extension>
  * Ej: ("Sprites/Mario","png") -> bin/Sprites/Mario.png
+ *
+ * Tambin puede apuntar a una zona de una pgina de TextureAtlas: la textura es compartida con los
+ * dems sprites de la pgina y el sprite solo muestra su rectngulo.
  */
 class Texture : public Component {
 public:
+	static constexpr ComponentType StaticType = ComponentType::TEXTURE;
+	using StaticTypeOwner = Texture;
+
 	Texture(const std::string& textureName, const std::string& extension = "png");
+
+	// Sprite dentro de una pgina del atlas (no carga nada de disco)
+	Texture(const std::string& textureName, const EngineUtilities::TSharedPointer<sf::Texture>& atlasPage,
+		const sf::IntRect& rect);
 	~Texture() override = default;
 
 	void start() override {}
@@ -32,11 +43,28 @@ public:
 	// Dibuja el sprite
 	void render(const EngineUtilities::TSharedPointer<Window>& window) override;
 
+	// Dibuja el sprite en cualquier RenderTarget (p. ej. una capa en RenderTexture)
+	void renderTo(sf::RenderTarget& target) const;
+
+	// Encola el sprite en la cola de render del frame
+	void submit(RenderQueue& queue, RenderLayer layer, float depth) const override;
+
+	// Aade el sprite al lote de su textura (un draw por textura en SpriteBatch::flush)
+	void addToBatch(SpriteBatch& batch) const;
+
 	void destroy() override {}
 
 	// Acceso al recurso (por si lo necesitas)
-	sf::Texture& getTexture() { return m_texture; }
-	const sf::Texture& getTexture() const { return m_texture; }
+	// Con atlas es la pgina completa: usa getTextureRect()/getSize() para la zona del sprite
+	sf::Texture& getTexture() { return m_page.isNull() ? m_texture : *m_page; }
+	const sf::Texture& getTexture() const { return m_page.isNull() ? m_texture : *m_page; }
+
+	// Zona del sprite dentro de getTexture() y su tamao en pxeles
+	const sf::IntRect& getTextureRect() const { return m_rect; }
+	sf::Vector2u getSize() const { return { unsigned(m_rect.size.x), unsigned(m_rect.size.y) }; }
+
+	// true si el sprite vive en una pgina de TextureAtlas
+	bool isAtlased() const { return !m_page.isNull(); }
 
 	// Los llama Actor para sincronizar con Transform
 	void setPosition(const sf::Vector2f& p);
@@ -44,7 +72,9 @@ public:
 	void setScale(const sf::Vector2f& s);
 
 private:
-	sf::Texture               m_texture;   // recurso
+	sf::Texture               m_texture;   // recurso (vaco si viene de un atlas)
+	EngineUtilities::TSharedPointer<sf::Texture> m_page; // pgina del atlas, compartida
+	sf::IntRect               m_rect;      // zona del sprite en la textura
 	std::optional<sf::Sprite> m_sprite;    // instancia visible (si carg)
 	std::string               m_name;      // ruta base (sin extensin)
 	std::string               m_ext;       // "png", etc.
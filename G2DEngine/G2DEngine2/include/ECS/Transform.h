@@ -2,25 +2,40 @@
 
 #include "Prerequisites.h"
 #include "ECS/Component.h"
+#include "Memory/TSharedPointer.h"
+#include "ECS/TransformStore.h"
 #include <SFML/System/Vector2.hpp>
 #include <SFML/System/Angle.hpp>        // para sf::degrees
 #include <SFML/Graphics/Transformable.hpp> // para applyTo
 #include <cmath>
 
-namespace EngineUtilities { template<typename T> class TSharedPointer; }
 class Window;
+class CShape;
+class Texture;
 
+/**
+ * @brief Componente de posición, rotación y escala.
+ *
+ * Los datos no viven en el componente: Transform es una vista sobre un índice del
+ * TransformStore del mundo (arreglos contiguos), que además sincroniza en lote los
+ * drawables enlazados por el Actor.
+ */
 class Transform : public Component {
 public:
+    static constexpr ComponentType StaticType = ComponentType::TRANSFORM;
+    using StaticTypeOwner = Transform;
+
     Transform()
         : Component(ComponentType::TRANSFORM)
-        , m_position(0.f, 0.f)
-        , m_rotationDegrees(0.f)
-        , m_scale(1.f, 1.f)
+        , m_store(&TransformStore::instance())
+        , m_index(m_store->create())
     {
     }
 
-    ~Transform() override = default;
+    Transform(const Transform&) = delete;
+    Transform& operator=(const Transform&) = delete;
+
+    ~Transform() override { m_store->release(m_index); }
 
     void start() override {}
     void update(float /* deltaTime */) override {}
@@ -28,7 +43,8 @@ public:
     void destroy() override {}
 
     void seek(const sf::Vector2f& target, float maxSpeed, float deltaTime, float arriveRadius = 10.f) {
-        sf::Vector2f toTarget = target - m_position;
+        const sf::Vector2f position = getPosition();
+        sf::Vector2f toTarget = target - position;
         float dist = std::sqrt(toTarget.x * toTarget.x + toTarget.y * toTarget.y);
         if (dist < 0.001f) return;
 
@@ -37,28 +53,38 @@ public:
         if (dist < arriveRadius) {
             speed = maxSpeed * (dist / arriveRadius);
         }
-        m_position += direction * speed * deltaTime;
+        setPosition(position + direction * speed * deltaTime);
     }
 
     // Setters
-    void setPosition(const sf::Vector2f& pos) { m_position = pos; }
-    void setRotation(float degrees) { m_rotationDegrees = degrees; }
-    void setScale(const sf::Vector2f& scale) { m_scale = scale; }
+    void setPosition(const sf::Vector2f& pos) { m_store->setPosition(m_index, pos); }
+    void setRotation(float degrees) { m_store->setRotation(m_index, degrees); }
+    void setScale(const sf::Vector2f& scale) { m_store->setScale(m_index, scale); }
 
-    // Getters
-    const sf::Vector2f& getPosition() const { return m_position; }
-    float getRotation() const { return m_rotationDegrees; }
-    const sf::Vector2f& getScale() const { return m_scale; }
+    // Getters (por valor: los datos están repartidos en arreglos separados)
+    sf::Vector2f getPosition() const { return m_store->getPosition(m_index); }
+    float getRotation() const { return m_store->getRotation(m_index); }
+    sf::Vector2f getScale() const { return m_store->getScale(m_index); }
 
     // Aplicar a un sf::Transformable (shape / sprite)
     void applyTo(sf::Transformable& t) const {
-        t.setPosition(m_position);
-        t.setRotation(sf::degrees(m_rotationDegrees));
-        t.setScale(m_scale);
+        t.setPosition(getPosition());
+        t.setRotation(sf::degrees(getRotation()));
+        t.setScale(getScale());
     }
 
+    // Enlaza los drawables que TransformStore::syncDrawables() mantiene al día
+    void bindDrawables(CShape* shape, Texture* texture) { m_store->bind(m_index, shape, texture); }
+
+    // Copia ya este transform a sus drawables si cambió (sin esperar al lote del frame)
+    void syncDrawables() { m_store->syncOne(m_index); }
+
+    // Contador de cambios: solo avanza cuando posición, rotación o escala cambian de valor
+    std::uint32_t getVersion() const { return m_store->getVersion(m_index); }
+
+    TransformStore::Index getStoreIndex() const { return m_index; }
+
 private:
-    sf::Vector2f m_position;
-    float        m_rotationDegrees; // en grados
-    sf::Vector2f m_scale;
+    TransformStore* m_store;
+    TransformStore::Index m_index;
 };
\ No newline at end of file
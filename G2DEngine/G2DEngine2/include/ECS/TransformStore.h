@@ -0,0 +1,186 @@
+#pragma once
+
+/**
+ * @file TransformStore.h
+ * @brief Almacén de transforms en estructura de arreglos (SoA) compartido por todo el mundo.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
+class CShape;
+class Texture;
+
+/**
+ * @class TransformStore
+ * @brief Guarda posición, rotación y escala de todos los Transform en arreglos contiguos.
+ *
+ * Cada componente Transform es una vista (índice) sobre este almacén. Los datos de cada campo
+ * viven en su propio arreglo (x[], y[], rot[], sx[], sy[]), de modo que recorrer miles de
+ * transforms toca memoria secuencial en lugar de saltar de objeto en objeto.
+ *
+ * syncDrawables() copia en un solo bucle los transforms modificados a la forma (CShape) y al
+ * sprite (Texture) que el Actor haya enlazado con bind(). Mientras una CShape está enlazada, sus
+ * setPosition/setRotation/setScale escriben en este almacén.
+ *
+ * Cada índice lleva un contador de versión que solo avanza cuando un valor cambia de verdad;
+ * la sincronización compara esa versión (y la de la CShape enlazada) con la última copiada, así
+ * que los actores quietos (pista, corredores en pausa o que ya terminaron) no cuestan nada.
+ *
+ * Para simular con paso fijo y dibujar a la frecuencia del monitor, snapshot() guarda posición y
+ * rotación antes del último paso de simulación y syncDrawables(alpha) dibuja la interpolación
+ * entre ese estado y el actual. Solo se interpolan los índices que cambiaron desde el snapshot.
+ *
+ * No es thread-safe: cada hilo tiene su propio almacén (instance()) y un Transform usa siempre
+ * el del hilo que lo creó, así que los actores de un mundo se crean, simulan y destruyen en el
+ * mismo hilo. Varios mundos independientes pueden simularse en paralelo (ver BatchRunner).
+ */
+class TransformStore {
+public:
+    using Index = std::uint32_t;
+    static constexpr Index InvalidIndex = ~Index(0);
+
+    /**
+     * @brief Resultado de la última pasada de syncDrawables().
+     */
+    struct SyncStats {
+        std::size_t synced = 0;   ///< Transforms copiados a sus drawables
+        std::size_t skipped = 0;  ///< Transforms enlazados que no cambiaron (sin copia)
+    };
+
+    /**
+     * @brief Almacén del hilo actual. Se crea en el primer uso y se destruye al terminar el hilo
+     * si ya no quedan transforms vivos (los hilos de BatchRunner destruyen su mundo antes). Si
+     * quedan, como los Transform estáticos del hilo principal, no se destruye, para que aún
+     * puedan liberar su índice al terminar el programa.
+     */
+    static TransformStore& instance();
+
+    TransformStore() = default;
+    TransformStore(const TransformStore&) = delete;
+    TransformStore& operator=(const TransformStore&) = delete;
+
+    /**
+     * @brief Reserva un índice con posición (0,0), rotación 0 y escala (1,1).
+     */
+    Index create();
+
+    /**
+     * @brief Libera el índice (y sus enlaces) para reutilizarlo.
+     */
+    void release(Index i);
+
+    /**
+     * @brief Reserva capacidad para count transforms (p.ej. antes de cargar una escena).
+     */
+    void reserve(std::size_t count);
+
+    // Lectura
+    sf::Vector2f getPosition(Index i) const { return { m_x[i], m_y[i] }; }
+    float getRotation(Index i) const { return m_rot[i]; }
+    sf::Vector2f getScale(Index i) const { return { m_sx[i], m_sy[i] }; }
+
+    // Escritura (avanza la versión solo si el valor cambia)
+    void setPosition(Index i, const sf::Vector2f& p) {
+        if (m_x[i] == p.x && m_y[i] == p.y) return;
+        m_x[i] = p.x; m_y[i] = p.y; ++m_version[i];
+    }
+    void setRotation(Index i, float degrees) {
+        if (m_rot[i] == degrees) return;
+        m_rot[i] = degrees; ++m_version[i];
+    }
+    void setScale(Index i, const sf::Vector2f& s) {
+        if (m_sx[i] == s.x && m_sy[i] == s.y) return;
+        m_sx[i] = s.x; m_sy[i] = s.y; ++m_version[i];
+    }
+
+    /** @brief Versión del transform i; cambia cada vez que posición, rotación o escala cambian. */
+    std::uint32_t getVersion(Index i) const { return m_version[i]; }
+
+    /**
+     * @brief Enlaza el índice con los drawables a los que syncDrawables() debe copiar el transform.
+     * @param shape Forma del actor (o nullptr).
+     * @param texture Sprite del actor (o nullptr).
+     */
+    void bind(Index i, CShape* shape, Texture* texture);
+
+    /**
+     * @brief Quita shape del índice i si sigue enlazada ahí (la CShape lo llama al destruirse).
+     */
+    void unbindShape(Index i, const CShape* shape);
+
+    /**
+     * @brief Guarda posición y rotación actuales como estado anterior para interpolar.
+     *
+     * Se llama antes del último paso de simulación de cada frame (y tras teletransportar
+     * actores, p.ej. un reset, para que no se interpole el salto).
+     */
+    void snapshot();
+
+    /**
+     * @brief Copia a sus drawables todos los transforms modificados desde la última llamada.
+     *
+     * También recopia los índices cuya CShape cambió (p.ej. createShape() generó una forma nueva).
+     * @param alpha Fracción entre el snapshot (0) y el estado actual (1). Con alpha < 1 los
+     *        índices que cambiaron desde snapshot() se dibujan interpolados; se vuelven a copiar
+     *        solo si cambia alpha, se toma otro snapshot o se modifican (un frame en pausa, con
+     *        el mismo alpha, no copia nada). Con 1 se copia el estado actual.
+     * @return Número de transforms sincronizados; las cifras completas quedan en lastSyncStats().
+     */
+    std::size_t syncDrawables(float alpha = 1.f);
+
+    /**
+     * @brief Copia el transform i a sus drawables si fue modificado (sincronización inmediata).
+     */
+    void syncOne(Index i);
+
+    /**
+     * @brief Sincronizados y omitidos en la última llamada a syncDrawables() (una por frame).
+     */
+    const SyncStats& lastSyncStats() const { return m_lastStats; }
+
+    // Acceso directo a los arreglos para sistemas que procesan transforms en lote
+    float* positionsX() { return m_x.data(); }
+    float* positionsY() { return m_y.data(); }
+    float* rotations() { return m_rot.data(); }
+    float* scalesX() { return m_sx.data(); }
+    float* scalesY() { return m_sy.data(); }
+
+    /**
+     * @brief Marca el índice como modificado (tras escribir directamente en los arreglos).
+     */
+    void markDirty(Index i) { ++m_version[i]; }
+
+    /** @brief Tamaño de los arreglos (índices en uso + libres). */
+    std::size_t size() const { return m_x.size(); }
+
+    /** @brief Índices en uso. */
+    std::size_t liveCount() const { return m_x.size() - m_free.size(); }
+
+private:
+    bool needsSync(Index i) const;
+    void writeDrawables(Index i);
+    void writeDrawables(Index i, const sf::Vector2f& pos, float rotation);
+
+    std::vector<float> m_x, m_y;                ///< Posición
+    std::vector<float> m_rot;                   ///< Rotación en grados
+    std::vector<float> m_sx, m_sy;              ///< Escala
+    std::vector<std::uint32_t> m_version;       ///< Versión actual del transform
+    std::vector<std::uint32_t> m_syncedVersion; ///< Versión copiada en la última sincronización
+    std::vector<std::uint32_t> m_shapeVersion;  ///< Versión de la CShape en la última sincronización
+    std::vector<CShape*> m_shapes;              ///< Forma enlazada por índice
+    std::vector<Texture*> m_textures;           ///< Sprite enlazado por índice
+    std::vector<float> m_prevX, m_prevY;        ///< Posición en el último snapshot()
+    std::vector<float> m_prevRot;               ///< Rotación en el último snapshot()
+    std::vector<std::uint32_t> m_snapshotVersion; ///< Versión en el último snapshot()
+    std::vector<std::uint8_t> m_hasSnapshot;    ///< 0 si el índice se creó después del snapshot
+    std::vector<std::uint8_t> m_interpolated;   ///< 1 si los drawables muestran un estado interpolado
+    std::vector<Index> m_free;                  ///< Índices liberados para reutilizar
+    std::uint32_t m_shapeEpoch = 0;             ///< CShape::changeEpoch() en la última pasada
+    float m_lastAlpha = -1.f;                   ///< alpha de la última pasada interpolada (-1: ninguna)
+    bool m_snapshotTaken = false;               ///< snapshot() se llamó después de la última pasada
+    SyncStats m_lastStats;                      ///< Cifras de la última syncDrawables()
+};
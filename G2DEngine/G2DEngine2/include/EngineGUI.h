@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Prerequisites.h"
+#include "Memory/TWeakPointer.h"
 #include <SFML/System.hpp>
 #include <imgui.h>
 #include <imgui-SFML.h>
@@ -96,13 +97,40 @@ public:
      */
     float getSpeedMultiplier() const { return m_speedMultiplier; }
 
+    /**
+     * @brief Frecuencia de la simulacin de paso fijo elegida en el panel.
+     * @return Pasos de simulacin por segundo.
+     */
+    int getSimulationHz() const { return m_simulationHz; }
+
+    /**
+     * @brief Pasos de simulacin mximos por frame elegidos en el panel.
+     */
+    int getMaxSubsteps() const { return m_maxSubsteps; }
+
+    /**
+     * @brief Indica si el render interpola entre los dos ltimos pasos de simulacin.
+     */
+    bool isInterpolationEnabled() const { return m_interpolate; }
+
+    /**
+     * @brief Indica si los sprites se dibujan agrupados por textura (SpriteBatch) o uno a uno.
+     */
+    bool isSpriteBatchingEnabled() const { return m_batchSprites; }
+
+    /**
+     * @brief Indica si la pista se dibuja desde la capa esttica horneada (StaticLayer) o cada frame.
+     */
+    bool isStaticLayerEnabled() const { return m_staticLayer; }
+
     /**
      * @brief Asigna la lista de corredores para mostrar en la GUI.
-     * @param racers Vector de punteros inteligentes a corredores.
+     * @param racers Corredores en orden de clasificacin (se muestran en ese orden).
+     * @note La GUI solo los observa (TWeakPointer); no prolonga su vida.
      */
     void setRacers(const std::vector<EngineUtilities::TSharedPointer<A_Racer>>& racers)
     {
-        m_racers = racers;
+        m_racers.assign(racers.begin(), racers.end());
     }
 
     /**
@@ -141,6 +169,11 @@ private:
     bool m_requestReset = false;  ///< Solicitud de reinicio de waypoints.
     bool m_paused = false;        ///< Estado de pausa del juego.
     float m_speedMultiplier = 1.f;///< Factor de velocidad del juego.
+    int m_simulationHz = 60;      ///< Pasos de simulacin por segundo.
+    int m_maxSubsteps = 8;        ///< Pasos de simulacin mximos por frame.
+    bool m_interpolate = true;    ///< Interpolar transforms al dibujar.
+    bool m_batchSprites = true;   ///< Un draw por textura en lugar de uno por sprite.
+    bool m_staticLayer = true;    ///< Pista horneada en una RenderTexture en lugar de redibujarla.
     Theme m_currentTheme = Theme::G2DEngine2; ///< Tema visual actual.
-    std::vector<EngineUtilities::TSharedPointer<A_Racer>> m_racers; ///< Lista de corredores mostrados en GUI.
+    std::vector<EngineUtilities::TWeakPointer<A_Racer>> m_racers; ///< Corredores mostrados en GUI (sin propiedad).
 };
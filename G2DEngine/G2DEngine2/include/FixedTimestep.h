@@ -0,0 +1,79 @@
+#pragma once
+
+/**
+ * @file FixedTimestep.h
+ * @brief Acumulador para avanzar la simulación con un paso fijo, independiente del frame rate.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @class FixedTimestep
+ * @brief Convierte el tiempo de cada frame en un número entero de pasos fijos de simulación.
+ *
+ * advance() suma el tiempo del frame al acumulador y devuelve cuántos pasos de getStep()
+ * segundos hay que ejecutar (como mucho getMaxSubsteps(); el tiempo que sobra se descarta para
+ * no entrar en una espiral de frames lentos). alpha() es la fracción de paso que quedó en el
+ * acumulador, para interpolar entre el estado anterior y el actual al dibujar.
+ *
+ * Uso:
+ * @code
+ * const int steps = timestep.advance(frameDt);
+ * for (int s = 0; s < steps; ++s) world.step(timestep.getStep());
+ * render(timestep.alpha());
+ * @endcode
+ */
+class FixedTimestep {
+public:
+    explicit FixedTimestep(float hz = 60.f, int maxSubsteps = 8) {
+        setRate(hz);
+        setMaxSubsteps(maxSubsteps);
+    }
+
+    /** @brief Frecuencia de la simulación, en pasos por segundo (mínimo 1). */
+    void setRate(float hz) { m_step = 1.f / std::max(hz, 1.f); }
+    float getRate() const { return 1.f / m_step; }
+
+    /** @brief Duración de un paso, en segundos. */
+    float getStep() const { return m_step; }
+
+    /** @brief Pasos máximos por frame (mínimo 1). */
+    void setMaxSubsteps(int count) { m_maxSubsteps = std::max(count, 1); }
+    int getMaxSubsteps() const { return m_maxSubsteps; }
+
+    /**
+     * @brief Acumula frameDt segundos y devuelve cuántos pasos fijos ejecutar este frame.
+     */
+    int advance(float frameDt) {
+        m_accumulator += std::max(frameDt, 0.f);
+
+        int steps = 0;
+        while (m_accumulator >= m_step && steps < m_maxSubsteps) {
+            m_accumulator -= m_step;
+            ++steps;
+        }
+        if (m_accumulator >= m_step) {
+            // Demasiado atrasados: se descartan los pasos enteros que no caben en maxSubsteps
+            const float whole = std::floor(m_accumulator / m_step) * m_step;
+            m_droppedTime += whole;
+            m_accumulator -= whole;
+        }
+        return steps;
+    }
+
+    /** @brief Fracción [0, 1) de paso pendiente en el acumulador. */
+    float alpha() const { return std::min(m_accumulator / m_step, 1.f); }
+
+    /** @brief Tiempo descartado por superar maxSubsteps desde el último reset(), en segundos. */
+    float getDroppedTime() const { return m_droppedTime; }
+
+    /** @brief Vacía el acumulador (p.ej. tras un reinicio o una pausa). */
+    void reset() { m_accumulator = 0.f; m_droppedTime = 0.f; }
+
+private:
+    float m_step = 1.f / 60.f;
+    int m_maxSubsteps = 8;
+    float m_accumulator = 0.f;
+    float m_droppedTime = 0.f;
+};
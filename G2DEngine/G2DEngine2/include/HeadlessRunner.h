@@ -0,0 +1,65 @@
+#pragma once
+
+#include <RaceWorld.h>
+
+#include <vector>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+/**
+ * @class HeadlessRunner
+ * @brief Corre carreras completas sin ventana, texturas ni GUI (CI, máquinas sin GPU).
+ *
+ * Construye la misma carrera que BaseApp (ruta, corredores, vueltas y meta), la avanza con un
+ * paso de tiempo fijo tan rápido como se pueda y repite hasta completar el número de carreras
+ * pedido. Imprime carreras/segundo, pasos/segundo y la clasificación final, así que también
+ * sirve como benchmark de throughput de la simulación.
+ *
+ * Uso: G2DEngine2 --headless [--races N] [--laps N] [--dt S] [--max-time S]
+ *                            [--steering batched|per-racer]
+ */
+class HeadlessRunner {
+public:
+    /**
+     * @brief Opciones de la ejecución.
+     */
+    struct Options {
+        int races = 100;            ///< Carreras a simular
+        int laps = 3;               ///< Vueltas por carrera
+        float dt = 1.f / 60.f;      ///< Paso fijo de simulación, en segundos
+        float maxRaceTime = 600.f;  ///< Tiempo simulado máximo por carrera (corta carreras atascadas)
+        RaceWorld::SteeringMode steering = RaceWorld::SteeringMode::Batched; ///< Steering en lote o por corredor
+    };
+
+    /**
+     * @brief Lee las opciones de la línea de comandos (ignora las que no conoce).
+     */
+    static Options parseOptions(int argc, char** argv);
+
+    /**
+     * @brief Indica si la línea de comandos pide el modo headless (--headless).
+     */
+    static bool isRequested(int argc, char** argv);
+
+    explicit HeadlessRunner(const Options& options) : m_options(options) {}
+
+    /**
+     * @brief Ejecuta todas las carreras e imprime el resumen.
+     * @return 0 si todas las carreras terminaron, 1 si alguna llegó a maxRaceTime.
+     */
+    int run();
+
+    /**
+     * @brief Línea de meta ahead px por delante de la salida: un rectángulo de size de largo
+     * atravesado por la ruta y size/4 de ancho en su sentido. La parrilla queda detrás, así que el
+     * primer cruce es la salida y no cuenta como vuelta. (La salida de la ruta por defecto es una
+     * horquilla cuyos dos tramos van muy juntos; la meta tiene que quedar donde ya se separaron.)
+     */
+    static sf::FloatRect finishLineAtStart(const std::vector<sf::Vector2f>& path, float size, float ahead);
+
+private:
+    void printStandings(int raceNumber) const;
+
+    Options m_options;
+    RaceWorld m_race;
+};
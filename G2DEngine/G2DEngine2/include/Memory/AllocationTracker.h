@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+
+namespace EngineUtilities {
+
+    /**
+     * @brief Etiquetado de secciones para atribuir asignaciones de heap.
+     *
+     * El motor marca las fases del frame con AllocationScope; un binario que reemplace
+     * operator new (p.ej. la herramienta FrameAllocCheck) consulta currentTag() para saber
+     * qué sección provocó cada asignación. Sin ese binario, el coste es escribir un puntero
+     * thread_local por sección.
+     */
+    class AllocationTracker
+    {
+    public:
+        // Etiqueta activa en el hilo actual (nullptr si ninguna)
+        static const char* currentTag() noexcept { return t_tag; }
+        static void setCurrentTag(const char* tag) noexcept { t_tag = tag; }
+
+    private:
+        static inline thread_local const char* t_tag = nullptr;
+    };
+
+    /**
+     * @brief Marca una sección mientras vive y restaura la etiqueta anterior al destruirse.
+     *
+     * set() permite pasar a la siguiente fase sin abrir otro bloque.
+     */
+    class AllocationScope
+    {
+    public:
+        explicit AllocationScope(const char* tag) noexcept
+            : m_previous(AllocationTracker::currentTag())
+        {
+            AllocationTracker::setCurrentTag(tag);
+        }
+
+        AllocationScope(const AllocationScope&) = delete;
+        AllocationScope& operator=(const AllocationScope&) = delete;
+
+        ~AllocationScope()
+        {
+            AllocationTracker::setCurrentTag(m_previous);
+        }
+
+        void set(const char* tag) noexcept { AllocationTracker::setCurrentTag(tag); }
+
+    private:
+        const char* m_previous;
+    };
+
+} // namespace EngineUtilities
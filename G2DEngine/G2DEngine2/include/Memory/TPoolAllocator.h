@@ -0,0 +1,191 @@
+#pragma once
+
+#include "TSharedPointer.h"
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace EngineUtilities {
+
+    /**
+     * @brief Pool de bloques de tamaño fijo.
+     *
+     * Reserva la memoria en páginas (chunks) de blocksPerChunk bloques contiguos y recicla los
+     * bloques liberados con una free-list intrusiva, así crear y destruir objetos del mismo tipo
+     * no pasa por malloc una vez que el pool tiene capacidad suficiente.
+     *
+     * Es seguro usarlo desde varios hilos (mutex interno); la sección crítica son dos punteros.
+     */
+    class FixedBlockPool
+    {
+    public:
+        FixedBlockPool(std::size_t blockSize, std::size_t blockAlign, std::size_t blocksPerChunk = 256)
+            : m_blockAlign(blockAlign < alignof(FreeNode) ? alignof(FreeNode) : blockAlign)
+            , m_blocksPerChunk(blocksPerChunk ? blocksPerChunk : 1)
+        {
+            // El bloque debe poder alojar el nodo de la free-list y mantener la alineación
+            std::size_t size = blockSize < sizeof(FreeNode) ? sizeof(FreeNode) : blockSize;
+            m_blockSize = (size + m_blockAlign - 1) / m_blockAlign * m_blockAlign;
+        }
+
+        FixedBlockPool(const FixedBlockPool&) = delete;
+        FixedBlockPool& operator=(const FixedBlockPool&) = delete;
+
+        ~FixedBlockPool()
+        {
+            for (void* chunk : m_chunks) {
+                ::operator delete(chunk, std::align_val_t(m_blockAlign));
+            }
+        }
+
+        // Devuelve un bloque sin inicializar de blockSize() bytes
+        void* allocate()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_freeList) addChunk();
+            FreeNode* node = m_freeList;
+            m_freeList = node->next;
+            ++m_live;
+            return node;
+        }
+
+        // Devuelve el bloque al pool (no libera memoria al sistema)
+        void deallocate(void* p) noexcept
+        {
+            if (!p) return;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            FreeNode* node = static_cast<FreeNode*>(p);
+            node->next = m_freeList;
+            m_freeList = node;
+            --m_live;
+        }
+
+        // Asegura capacidad para al menos blocks bloques (p.ej. antes de cargar una escena)
+        void reserve(std::size_t blocks)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            while (m_chunks.size() * m_blocksPerChunk < blocks) addChunk();
+        }
+
+        std::size_t blockSize() const noexcept { return m_blockSize; }
+
+        // Bloques en uso
+        std::size_t liveBlocks() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_live;
+        }
+
+        // Bloques reservados en total (en uso + libres)
+        std::size_t capacity() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_chunks.size() * m_blocksPerChunk;
+        }
+
+        // Número de reservas al sistema hechas por el pool
+        std::size_t chunkCount() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_chunks.size();
+        }
+
+    private:
+        struct FreeNode { FreeNode* next; };
+
+        // Reserva una página nueva y enlaza sus bloques en orden de dirección
+        void addChunk()
+        {
+            char* chunk = static_cast<char*>(
+                ::operator new(m_blockSize * m_blocksPerChunk, std::align_val_t(m_blockAlign)));
+            m_chunks.push_back(chunk);
+
+            for (std::size_t i = m_blocksPerChunk; i-- > 0;) {
+                FreeNode* node = reinterpret_cast<FreeNode*>(chunk + i * m_blockSize);
+                node->next = m_freeList;
+                m_freeList = node;
+            }
+        }
+
+        std::size_t m_blockSize = 0;
+        std::size_t m_blockAlign;
+        std::size_t m_blocksPerChunk;
+        FreeNode* m_freeList = nullptr;
+        std::size_t m_live = 0;
+        std::vector<void*> m_chunks;
+        mutable std::mutex m_mutex;
+    };
+
+    namespace Detail {
+
+        // Un pool por tipo de bloque. Se crea en el primer uso y no se destruye nunca, para que
+        // punteros con duración estática puedan liberarse de forma segura al terminar el programa.
+        template<typename Block>
+        FixedBlockPool& blockPool()
+        {
+            static FixedBlockPool* pool = new FixedBlockPool(sizeof(Block), alignof(Block));
+            return *pool;
+        }
+
+        // Bloque de control con el objeto en línea cuya memoria sale del pool de su tipo
+        template<typename T, typename RefPolicy>
+        class TPooledBlock final : public RefCountBlock<RefPolicy>
+        {
+        public:
+            template<typename... Args>
+            explicit TPooledBlock(Args&&... args)
+            {
+                ::new (static_cast<void*>(storage)) T(std::forward<Args>(args)...);
+            }
+
+            T* get() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+
+            void destroyObject() noexcept override { get()->~T(); }
+            void destroyBlock() noexcept override
+            {
+                this->~TPooledBlock();
+                blockPool<TPooledBlock>().deallocate(this);
+            }
+
+        private:
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+    } // namespace Detail
+
+    /**
+     * @brief Pool del que MakePooled<T> toma la memoria (para reserve() y estadísticas).
+     */
+    template<typename T, typename RefPolicy = SingleThreadRefCount>
+    FixedBlockPool& GetObjectPool()
+    {
+        return Detail::blockPool<Detail::TPooledBlock<T, RefPolicy>>();
+    }
+
+    /**
+     * @brief Como MakeShared, pero el bloque (objeto + contadores) sale del pool de T.
+     *
+     * Los objetos del mismo tipo quedan contiguos en memoria y crear/destruir miles de ellos
+     * reutiliza los mismos bloques sin llamar a malloc.
+     */
+    template<typename T, typename... Args>
+    TSharedPointer<T> MakePooled(Args&&... args)
+    {
+        using Block = Detail::TPooledBlock<T, SingleThreadRefCount>;
+        FixedBlockPool& pool = Detail::blockPool<Block>();
+        void* mem = pool.allocate();
+        Block* block = nullptr;
+        try {
+            block = ::new (mem) Block(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            pool.deallocate(mem);
+            throw;
+        }
+        return Detail::SharedAccess::adopt<T, SingleThreadRefCount>(block->get(), block);
+    }
+
+} // namespace EngineUtilities
@@ -2,28 +2,170 @@
 
 #include <utility> // std::exchange, std::swap
 #include <type_traits>
+#include <new>
+#include <atomic>
 
 namespace EngineUtilities {
 
-    template<typename T>
+    /**
+     * @brief Poltica de recuento no atmica (por defecto): para objetos que viven en un solo hilo.
+     */
+    struct SingleThreadRefCount
+    {
+        using Counter = int;
+
+        static void increment(Counter& c) noexcept { ++c; }
+        // Devuelve true si era la ltima referencia
+        static bool decrement(Counter& c) noexcept { return --c == 0; }
+        // Incrementa solo si an hay referencias (lo usa TWeakPointer::lock)
+        static bool incrementIfNotZero(Counter& c) noexcept
+        {
+            if (c == 0) return false;
+            ++c;
+            return true;
+        }
+        static int load(const Counter& c) noexcept { return c; }
+    };
+
+    /**
+     * @brief Poltica de recuento atmica: permite compartir el objeto entre hilos.
+     *
+     * Los incrementos son relaxed (quien copia ya tiene una referencia vlida); el
+     * decremento es acq_rel para que el hilo que destruye vea todas las escrituras previas.
+     */
+    struct AtomicRefCount
+    {
+        using Counter = std::atomic<int>;
+
+        static void increment(Counter& c) noexcept { c.fetch_add(1, std::memory_order_relaxed); }
+        static bool decrement(Counter& c) noexcept { return c.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+        static bool incrementIfNotZero(Counter& c) noexcept
+        {
+            int cur = c.load(std::memory_order_relaxed);
+            while (cur != 0) {
+                if (c.compare_exchange_weak(cur, cur + 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+                    return true;
+            }
+            return false;
+        }
+        static int load(const Counter& c) noexcept { return c.load(std::memory_order_relaxed); }
+    };
+
+    template<typename T, typename RefPolicy = SingleThreadRefCount>
+    class TSharedPointer;
+
+    template<typename T, typename RefPolicy = SingleThreadRefCount>
+    class TWeakPointer;
+
+    namespace Detail {
+
+        // Bloque de control: recuentos fuerte y dbil + cmo destruir objeto y bloque.
+        // Solo destroyObject/destroyBlock son virtuales; copiar o liberar un puntero
+        // no hace ninguna llamada indirecta.
+        //
+        // Los TSharedPointer vivos cuentan en conjunto como una referencia dbil, as el
+        // bloque sobrevive al objeto mientras quede algn TWeakPointer que lo consulte.
+        template<typename RefPolicy>
+        class RefCountBlock
+        {
+        public:
+            typename RefPolicy::Counter strong{ 1 };
+            typename RefPolicy::Counter weak{ 1 };
+
+            // Libera una referencia fuerte; destruye el objeto y, si no hay dbiles, el bloque
+            void releaseStrong() noexcept
+            {
+                if (RefPolicy::decrement(strong)) {
+                    destroyObject();
+                    releaseWeak();
+                }
+            }
+
+            // Libera una referencia dbil; el ltimo en salir libera el bloque
+            void releaseWeak() noexcept
+            {
+                if (RefPolicy::decrement(weak)) {
+                    destroyBlock();
+                }
+            }
+
+            // Destruye el objeto gestionado (se llama cuando strong llega a 0)
+            virtual void destroyObject() noexcept = 0;
+            // Libera la memoria del propio bloque
+            virtual void destroyBlock() noexcept = 0;
+
+        protected:
+            virtual ~RefCountBlock() = default;
+        };
+
+        // Bloque para punteros crudos adoptados (TSharedPointer(T*), reset(T*)): dos reservas
+        template<typename T, typename RefPolicy>
+        class TPointerBlock final : public RefCountBlock<RefPolicy>
+        {
+        public:
+            explicit TPointerBlock(T* p) noexcept : ptr(p) {}
+
+            void destroyObject() noexcept override { delete ptr; }
+            void destroyBlock() noexcept override { delete this; }
+
+        private:
+            T* ptr;
+        };
+
+        // Bloque con el objeto en lnea (MakeShared): objeto y contador en una sola reserva
+        template<typename T, typename RefPolicy>
+        class TInplaceBlock final : public RefCountBlock<RefPolicy>
+        {
+        public:
+            template<typename... Args>
+            explicit TInplaceBlock(Args&&... args)
+            {
+                ::new (static_cast<void*>(storage)) T(std::forward<Args>(args)...);
+            }
+
+            T* get() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+
+            void destroyObject() noexcept override { get()->~T(); }
+            void destroyBlock() noexcept override { delete this; }
+
+        private:
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        // Punto de acceso para las funciones Make*: adopta un bloque recin creado (strong = 1)
+        struct SharedAccess
+        {
+            template<typename T, typename RefPolicy>
+            static TSharedPointer<T, RefPolicy> adopt(T* ptr, RefCountBlock<RefPolicy>* block) noexcept
+            {
+                return TSharedPointer<T, RefPolicy>(ptr, block, typename TSharedPointer<T, RefPolicy>::AdoptTag{});
+            }
+        };
+
+    } // namespace Detail
+
+    template<typename T, typename RefPolicy>
     class TSharedPointer
     {
     public:
+        using Block = Detail::RefCountBlock<RefPolicy>;
+
         // Constructor por defecto
         TSharedPointer() noexcept : ptr(nullptr), refCount(nullptr) {}
 
         // Desde puntero crudo
-        explicit TSharedPointer(T* rawPtr) : ptr(rawPtr), refCount(new int(1)) {}
+        explicit TSharedPointer(T* rawPtr)
+            : ptr(rawPtr), refCount(rawPtr ? new Detail::TPointerBlock<T, RefPolicy>(rawPtr) : nullptr) {}
 
         // Copia (incrementa refcount)
-        TSharedPointer(const TSharedPointer<T>& other) noexcept
+        TSharedPointer(const TSharedPointer& other) noexcept
             : ptr(other.ptr), refCount(other.refCount)
         {
-            if (refCount) ++(*refCount);
+            if (refCount) RefPolicy::increment(refCount->strong);
         }
 
         // Movimiento
-        TSharedPointer(TSharedPointer<T>&& other) noexcept
+        TSharedPointer(TSharedPointer&& other) noexcept
             : ptr(std::exchange(other.ptr, nullptr)),
             refCount(std::exchange(other.refCount, nullptr))
         {
@@ -31,26 +173,35 @@ namespace EngineUtilities {
 
         // Conversin esttica desde otro tipo convertible
         template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
-        TSharedPointer(const TSharedPointer<U>& other) noexcept
+        TSharedPointer(const TSharedPointer<U, RefPolicy>& other) noexcept
             : ptr(other.ptr), refCount(other.refCount)
         {
-            if (refCount) ++(*refCount);
+            if (refCount) RefPolicy::increment(refCount->strong);
+        }
+
+        // Conversin por movimiento desde otro tipo convertible (sin tocar el refcount)
+        template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+        TSharedPointer(TSharedPointer<U, RefPolicy>&& other) noexcept
+            : ptr(std::exchange(other.ptr, nullptr)),
+            refCount(std::exchange(other.refCount, nullptr))
+        {
         }
 
         // Asignacin copia
-        TSharedPointer<T>& operator=(const TSharedPointer<T>& other) noexcept
+        TSharedPointer& operator=(const TSharedPointer& other) noexcept
         {
             if (this != &other) {
+                // Incrementa antes de liberar por si ambos comparten bloque
+                if (other.refCount) RefPolicy::increment(other.refCount->strong);
                 release_internal();
                 ptr = other.ptr;
                 refCount = other.refCount;
-                if (refCount) ++(*refCount);
             }
             return *this;
         }
 
         // Asignacin movimiento
-        TSharedPointer<T>& operator=(TSharedPointer<T>&& other) noexcept
+        TSharedPointer& operator=(TSharedPointer&& other) noexcept
         {
             if (this != &other) {
                 release_internal();
@@ -77,13 +228,16 @@ namespace EngineUtilities {
         // Obtener puntero crudo
         T* get() const noexcept { return ptr; }
 
+        // Nmero de TSharedPointer que comparten el objeto (0 si es nulo)
+        int useCount() const noexcept { return refCount ? RefPolicy::load(refCount->strong) : 0; }
+
         // Resetear
-        void reset(T* newPtr = nullptr) noexcept
+        void reset(T* newPtr = nullptr)
         {
             release_internal();
             if (newPtr) {
                 ptr = newPtr;
-                refCount = new int(1);
+                refCount = new Detail::TPointerBlock<T, RefPolicy>(newPtr);
             }
             else {
                 ptr = nullptr;
@@ -92,7 +246,7 @@ namespace EngineUtilities {
         }
 
         // Swap
-        void swap(TSharedPointer<T>& other) noexcept
+        void swap(TSharedPointer& other) noexcept
         {
             std::swap(ptr, other.ptr);
             std::swap(refCount, other.refCount);
@@ -100,60 +254,86 @@ namespace EngineUtilities {
 
         // static_pointer_cast equivalente
         template<typename U>
-        TSharedPointer<U> static_pointer_cast() const noexcept
+        TSharedPointer<U, RefPolicy> static_pointer_cast() const noexcept
         {
             U* casted = static_cast<U*>(ptr);
             if (casted) {
-                return TSharedPointer<U>(casted, refCount);
+                return TSharedPointer<U, RefPolicy>(casted, refCount);
             }
-            return TSharedPointer<U>();
+            return TSharedPointer<U, RefPolicy>();
         }
 
         // dynamic_pointer_cast equivalente
         template<typename U>
-        TSharedPointer<U> dynamic_pointer_cast() const noexcept
+        TSharedPointer<U, RefPolicy> dynamic_pointer_cast() const noexcept
         {
             U* casted = dynamic_cast<U*>(ptr);
             if (casted) {
-                return TSharedPointer<U>(casted, refCount);
+                return TSharedPointer<U, RefPolicy>(casted, refCount);
             }
-            return TSharedPointer<U>();
+            return TSharedPointer<U, RefPolicy>();
         }
 
     private:
         // Constructor interno usado por castings para compartir refCount sin incrementarlo dos veces
-        TSharedPointer(T* rawPtr, int* existingRefCount) noexcept
+        TSharedPointer(T* rawPtr, Block* existingRefCount) noexcept
             : ptr(rawPtr), refCount(existingRefCount)
         {
-            if (refCount) ++(*refCount);
+            if (refCount) RefPolicy::increment(refCount->strong);
+        }
+
+        // Adopta un bloque recin creado (strong ya vale 1)
+        struct AdoptTag {};
+        TSharedPointer(T* rawPtr, Block* newBlock, AdoptTag) noexcept
+            : ptr(rawPtr), refCount(newBlock)
+        {
         }
 
         void release_internal() noexcept
         {
             if (refCount) {
-                if (--(*refCount) == 0) {
-                    delete ptr;
-                    delete refCount;
-                }
+                refCount->releaseStrong();
                 ptr = nullptr;
                 refCount = nullptr;
             }
         }
 
         T* ptr;
-        int* refCount;
+        Block* refCount;
 
         // Hacer accesibles los miembros en el constructor de conversin de otro tipo
-        template<typename> friend class TSharedPointer;
+        template<typename, typename> friend class TSharedPointer;
+        template<typename, typename> friend class TWeakPointer;
+        friend struct Detail::SharedAccess;
     };
 
+    /**
+     * @brief TSharedPointer con recuento atmico, para objetos compartidos entre hilos.
+     */
+    template<typename T>
+    using TAtomicSharedPointer = TSharedPointer<T, AtomicRefCount>;
+
     /**
      * @brief Crea un TSharedPointer con perfect forwarding.
+     *
+     * El objeto y su bloque de control se reservan juntos (una sola reserva, igual que
+     * std::make_shared), as desreferenciar y liberar tocan la misma lnea de cach.
      */
     template<typename T, typename... Args>
     TSharedPointer<T> MakeShared(Args&&... args)
     {
-        return TSharedPointer<T>(new T(std::forward<Args>(args)...));
+        auto* block = new Detail::TInplaceBlock<T, SingleThreadRefCount>(std::forward<Args>(args)...);
+        return Detail::SharedAccess::adopt<T, SingleThreadRefCount>(block->get(), block);
+    }
+
+    /**
+     * @brief Igual que MakeShared pero con recuento atmico (TAtomicSharedPointer).
+     */
+    template<typename T, typename... Args>
+    TAtomicSharedPointer<T> MakeAtomicShared(Args&&... args)
+    {
+        auto* block = new Detail::TInplaceBlock<T, AtomicRefCount>(std::forward<Args>(args)...);
+        return Detail::SharedAccess::adopt<T, AtomicRefCount>(block->get(), block);
     }
 
-} // namespace EngineUtilities
\ No newline at end of file
+} // namespace EngineUtilities
@@ -36,23 +36,82 @@ namespace EngineUtilities {
 		 * La clase TWeakPointer proporciona una manera de observar un objeto gestionado por un TSharedPointer
 		 * sin tener influencia sobre el recuento de referencias del objeto. Permite acceder al objeto solo si
 		 * an existe.
+		 *
+		 * Comparte el bloque de control del TSharedPointer: el recuento dbil mantiene vivo el bloque
+		 * (no el objeto), de modo que expired() y lock() siguen siendo vlidos despus de destruirse
+		 * el objeto.
 		 */
-	template<typename T>
+	template<typename T, typename RefPolicy>
 	class TWeakPointer
 	{
 	public:
+		using Block = Detail::RefCountBlock<RefPolicy>;
+
 		/**
 		 * @brief Constructor por defecto.
 		 */
-		TWeakPointer() : ptr(nullptr), refCount(nullptr) {}
+		TWeakPointer() noexcept : ptr(nullptr), refCount(nullptr) {}
 
 		/**
 		 * @brief Constructor que toma un TSharedPointer.
 		 *
 		 * @param sharedPtr TSharedPointer desde el cual se observar el objeto.
 		 */
-		TWeakPointer(const TSharedPointer<T>& sharedPtr)
+		template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+		TWeakPointer(const TSharedPointer<U, RefPolicy>& sharedPtr) noexcept
 			: ptr(sharedPtr.ptr), refCount(sharedPtr.refCount) {
+			if (refCount) RefPolicy::increment(refCount->weak);
+		}
+
+		/**
+		 * @brief Constructor copia (incrementa el recuento dbil).
+		 */
+		TWeakPointer(const TWeakPointer& other) noexcept
+			: ptr(other.ptr), refCount(other.refCount) {
+			if (refCount) RefPolicy::increment(refCount->weak);
+		}
+
+		/**
+		 * @brief Constructor de movimiento.
+		 */
+		TWeakPointer(TWeakPointer&& other) noexcept
+			: ptr(std::exchange(other.ptr, nullptr)),
+			refCount(std::exchange(other.refCount, nullptr)) {
+		}
+
+		/**
+		 * @brief Asignacin copia.
+		 */
+		TWeakPointer& operator=(const TWeakPointer& other) noexcept
+		{
+			if (this != &other) {
+				if (other.refCount) RefPolicy::increment(other.refCount->weak);
+				reset();
+				ptr = other.ptr;
+				refCount = other.refCount;
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Asignacin por movimiento.
+		 */
+		TWeakPointer& operator=(TWeakPointer&& other) noexcept
+		{
+			if (this != &other) {
+				reset();
+				ptr = std::exchange(other.ptr, nullptr);
+				refCount = std::exchange(other.refCount, nullptr);
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Destructor: libera la referencia dbil (y el bloque si era la ltima).
+		 */
+		~TWeakPointer()
+		{
+			reset();
 		}
 
 		/**
@@ -60,22 +119,47 @@ namespace EngineUtilities {
 		 *
 		 * @return Un TSharedPointer al objeto gestionado, o nullptr si el objeto ha sido destruido.
 		 */
-		TSharedPointer<T> lock() const
+		TSharedPointer<T, RefPolicy> lock() const noexcept
 		{
-			if (refCount && *refCount > 0)
+			if (refCount && RefPolicy::incrementIfNotZero(refCount->strong))
 			{
-				return TSharedPointer<T>(ptr, refCount);
+				return TSharedPointer<T, RefPolicy>(ptr, refCount,
+					typename TSharedPointer<T, RefPolicy>::AdoptTag{});
 			}
-			return TSharedPointer<T>();
+			return TSharedPointer<T, RefPolicy>();
+		}
+
+		/**
+		 * @brief Indica si el objeto observado ya fue destruido (o si nunca hubo objeto).
+		 */
+		bool expired() const noexcept
+		{
+			return !refCount || RefPolicy::load(refCount->strong) == 0;
 		}
 
-		// Hacer que TSharedPointer sea un amigo para acceder a los miembros privados.
-		template<typename U>
-		friend class TSharedPointer;
+		/**
+		 * @brief Nmero de TSharedPointer que mantienen vivo el objeto.
+		 */
+		int useCount() const noexcept
+		{
+			return refCount ? RefPolicy::load(refCount->strong) : 0;
+		}
+
+		/**
+		 * @brief Deja de observar el objeto.
+		 */
+		void reset() noexcept
+		{
+			if (refCount) {
+				refCount->releaseWeak();
+				ptr = nullptr;
+				refCount = nullptr;
+			}
+		}
 
 	private:
-		T* ptr;       ///< Puntero al objeto observado.
-		int* refCount; ///< Puntero al recuento de referencias del TSharedPointer original.
+		T* ptr;         ///< Puntero al objeto observado (solo vlido si !expired()).
+		Block* refCount; ///< Bloque de control compartido con los TSharedPointer.
 	};
 
 	/*
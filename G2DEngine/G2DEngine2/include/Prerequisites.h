@@ -16,6 +16,8 @@
 #include <unordered_map>///< Hash table-based associative container.
 
 #include <Memory/TSharedPointer.h>
+#include <Memory/TPoolAllocator.h>
+#include <Memory/AllocationTracker.h>
 #include <Memory/TStaticPtr.h>
 #include <Memory/TUniquePtr.h>
 
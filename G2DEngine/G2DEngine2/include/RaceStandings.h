@@ -0,0 +1,54 @@
+#pragma once
+
+/**
+ * @file RaceStandings.h
+ * @brief Clasificación de la carrera mantenida de forma incremental.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class RaceStandings
+ * @brief Orden de los corredores (líder primero) que se repara en cada paso en lugar de
+ * ordenarse desde cero.
+ *
+ * Cada corredor se identifica por su índice [0, count) y tiene una clave numérica; mayor clave
+ * = mejor posición. update() recalcula las claves y repara el orden del paso anterior con una
+ * pasada de inserción: como entre dos pasos solo se adelantan unos pocos corredores, el coste es
+ * O(n + intercambios) en lugar de O(n log n). Los empates conservan el orden previo.
+ */
+class RaceStandings {
+public:
+    /**
+     * @brief Reinicia la clasificación para count corredores, en orden de índice.
+     */
+    void reset(std::size_t count);
+
+    /**
+     * @brief Recalcula las claves y repara el orden.
+     * @param keyOf Llamable keyOf(index) -> double con la clave del corredor index.
+     * @return Intercambios hechos (0 si el orden no cambió).
+     */
+    template<typename KeyFn>
+    std::size_t update(KeyFn&& keyOf) {
+        for (std::size_t i = 0; i < m_keys.size(); ++i) m_keys[i] = keyOf(i);
+        return repair();
+    }
+
+    /** @brief Índices de los corredores, del primero al último. */
+    const std::vector<std::uint32_t>& order() const { return m_order; }
+
+    /** @brief Intercambios de la última update() (cuántas posiciones cambiaron). */
+    std::size_t lastSwaps() const { return m_lastSwaps; }
+
+    std::size_t size() const { return m_order.size(); }
+
+private:
+    std::size_t repair();
+
+    std::vector<double> m_keys;          ///< Clave por índice de corredor
+    std::vector<std::uint32_t> m_order;  ///< Índices ordenados por clave descendente
+    std::size_t m_lastSwaps = 0;
+};
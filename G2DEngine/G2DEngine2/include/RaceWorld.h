@@ -0,0 +1,163 @@
+#pragma once
+
+#include <Prerequisites.h>
+#include <A_Racer.h>
+#include <RaceStandings.h>
+#include <SpatialHashGrid.h>
+#include <SteeringBatch.h>
+#include <TrackPath.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+/**
+ * @class RaceWorld
+ * @brief Estado y lógica de una carrera, sin ventana, texturas ni GUI.
+ *
+ * Contiene la ruta, los corredores, la línea de meta, las vueltas y el orden de llegada.
+ * BaseApp la usa dentro de su frame (y le añade render y GUI); el modo headless la avanza
+ * directamente con un paso de tiempo fijo.
+ */
+class RaceWorld {
+public:
+    using RacerPtr = EngineUtilities::TSharedPointer<A_Racer>;
+
+    /**
+     * @brief Cómo mueve step() a los corredores.
+     */
+    enum class SteeringMode {
+        PerRacer,  ///< A_Racer::update() de cada corredor
+        Batched    ///< Todos los corredores activos en un SteeringBatch (SIMD)
+    };
+
+    /**
+     * @brief Crea la ruta por defecto y los cuatro corredores en su parrilla de salida.
+     * @param laps Vueltas de la carrera.
+     */
+    void buildDefault(int laps = 3);
+
+    /**
+     * @brief Sustituye la ruta y reparte a los corredores en carriles paralelos a ella.
+     *
+     * Todos los corredores comparten la nueva ruta; cada carril se calcula una sola vez.
+     * @param path Ruta cerrada (ya densificada).
+     * @param laneOffsets Desplazamiento lateral de cada carril; el corredor i usa el carril
+     *        i (o el último si hay más corredores que carriles). Si está vacío cada corredor
+     *        conserva su offset actual, sobre la ruta nueva.
+     */
+    void setPath(const std::vector<sf::Vector2f>& path, const std::vector<float>& laneOffsets);
+
+    /**
+     * @brief Asigna la línea de meta a todos los corredores.
+     */
+    void setFinishLine(const sf::FloatRect& finishLine);
+
+    /**
+     * @brief Asigna el número de vueltas a todos los corredores.
+     */
+    void setTotalLaps(int laps);
+
+    /**
+     * @brief Avanza la simulación dt segundos: mueve a los corredores y registra llegadas.
+     */
+    void step(float dt);
+
+    /**
+     * @brief Devuelve a todos los corredores a la salida y reinicia cronómetro y clasificación.
+     */
+    void reset();
+
+    /**
+     * @brief Indica si todos los corredores terminaron.
+     */
+    bool isFinished() const;
+
+    void setSteeringMode(SteeringMode mode) { m_steeringMode = mode; }
+    SteeringMode getSteeringMode() const { return m_steeringMode; }
+
+    /**
+     * @brief Ajusta la separación entre corredores que se aplica tras la dirección.
+     * @param radius Distancia (px) a partir de la cual dos corredores dejan de empujarse.
+     * @param strength Velocidad máxima de empuje (px/s); 0 la desactiva.
+     */
+    void setSeparation(float radius, float strength);
+    float getSeparationRadius() const { return m_separationRadius; }
+    float getSeparationStrength() const { return m_separationStrength; }
+
+    /** @brief Rejilla de proximidad con las posiciones del último step() (solo corredores activos). */
+    const SpatialHashGrid& getProximityGrid() const { return m_grid; }
+
+    /** @brief Tiempo de carrera simulado, en segundos. */
+    float getRaceTime() const { return m_raceTime; }
+
+    const std::vector<sf::Vector2f>& getPath() const { return m_track->points(); }
+    const TrackPath::Ptr& getTrack() const { return m_track; }
+    const std::vector<RacerPtr>& getRacers() const { return m_racers; }
+    const sf::FloatRect& getFinishLine() const { return m_finishLine; }
+
+    /**
+     * @brief Clasificación actual, líder primero: los que terminaron por orden de llegada y
+     * después el resto por avance (vueltas + fracción de vuelta). Se repara en cada step(), no se reordena.
+     */
+    const std::vector<RacerPtr>& getStandings() const { return m_standingsOrder; }
+
+    /** @brief Corredores que cambiaron de posición en el último step(). */
+    std::size_t getStandingsSwaps() const { return m_standings.lastSwaps(); }
+
+    /** @brief Corredores en orden de llegada. */
+    const std::vector<RacerPtr>& getFinishedOrder() const { return m_finishedOrder; }
+
+    /**
+     * @brief Tiempo de llegada de cada corredor de getFinishedOrder(), en el mismo orden. Es el
+     * instante en que cruzó la meta dentro del paso, no el final del paso.
+     */
+    const std::vector<float>& getFinishTimes() const { return m_finishTimes; }
+
+    /**
+     * @brief Tiempo de carrera en que el corredor m_racers[racer] completó cada vuelta
+     * (acumulado; la duración de la vuelta k es la resta con la k-1).
+     */
+    const std::vector<float>& getLapTimes(std::size_t racer) const { return m_lapTimes[racer]; }
+
+    /**
+     * @brief Densifica una polilínea cerrada para que los segmentos no superen maxSegLen px.
+     */
+    static std::vector<sf::Vector2f> densifyClosed(const std::vector<sf::Vector2f>& pts, float maxSegLen);
+
+    /**
+     * @brief Offset lateral de una polilínea cerrada usando bisectriz (más suave en curvas).
+     * Equivale a TrackPath::offsetPoints(); los carriles de los corredores usan TrackPath::lane().
+     */
+    static std::vector<sf::Vector2f> offsetClosed(const std::vector<sf::Vector2f>& path, float offsetPx);
+
+private:
+    void stepBatched(float dt);
+    void applySeparation(float dt);
+    void rebuildStandings();
+    void updateStandings();
+
+    TrackPath::Ptr m_track = TrackPath::create({});
+    std::vector<RacerPtr> m_racers;
+    std::vector<RacerPtr> m_finishedOrder;
+    std::vector<float> m_finishTimes;
+    std::vector<std::vector<float>> m_lapTimes;                 ///< Por índice de corredor
+    std::vector<std::pair<float, std::size_t>> m_stepFinishers; ///< Llegadas del paso actual
+    sf::FloatRect m_finishLine;
+    float m_raceTime = 0.f;
+
+    SteeringMode m_steeringMode = SteeringMode::Batched;
+    SteeringBatch m_steering;
+    std::vector<A_Racer*> m_steeringRacers;   ///< Corredor de cada entrada de m_steering
+
+    float m_separationRadius = 24.f;
+    float m_separationStrength = 80.f;
+    SpatialHashGrid m_grid{ 24.f };           ///< Se reconstruye en cada step()
+    std::vector<A_Racer*> m_gridRacers;       ///< Corredor de cada punto de m_grid
+    std::vector<float> m_gridX, m_gridY;
+
+    RaceStandings m_standings;                ///< Orden incremental (índices en m_racers)
+    std::vector<RacerPtr> m_standingsOrder;   ///< m_racers en el orden de m_standings
+};
@@ -0,0 +1,133 @@
+#pragma once
+
+/**
+ * @file RenderQueue.h
+ * @brief Cola de comandos de render ordenados por clave (capa, profundidad, textura).
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SFML/Graphics/PrimitiveType.hpp>
+
+namespace sf {
+    class Drawable;
+    class Shape;
+    class Sprite;
+    class Texture;
+    struct Vertex;
+}
+
+/**
+ * @brief Capas de dibujo, de atrás hacia delante. Es el campo más significativo de la clave.
+ */
+enum class RenderLayer : std::uint8_t {
+    Background = 0,   ///< Pista, capa estática
+    World = 1,        ///< Decorado del mundo
+    Debug = 2,        ///< Rutas, marcadores
+    Sprites = 3,      ///< Corredores
+    Overlay = 4       ///< Por encima de todo (HUD propio; ImGui va aparte)
+};
+
+/**
+ * @brief Cómo se ordenan los comandos de una capa que comparten profundidad.
+ */
+enum class RenderSort : std::uint8_t {
+    Submission = 0,   ///< En orden de envío (por defecto): lo que se solapa se pinta como se envió
+    Texture = 1       ///< Agrupados por textura y luego por envío; solo si no se solapan
+};
+
+/**
+ * @brief Un draw pendiente: un sf::Drawable o un arreglo de vértices, con su textura.
+ *
+ * Los punteros deben seguir vivos hasta Window::flush().
+ */
+struct RenderCommand {
+    std::uint64_t key = 0;
+    const sf::Texture* texture = nullptr;    ///< Textura que enlaza el draw (nullptr = ninguna)
+    const sf::Drawable* drawable = nullptr;  ///< Si no es nulo, se dibuja esto...
+    const sf::Vertex* vertices = nullptr;    ///< ...si no, este arreglo
+    std::size_t vertexCount = 0;
+    sf::PrimitiveType primitive = sf::PrimitiveType::Triangles;
+};
+
+/**
+ * @brief Contadores de un frame (ver Window::getRenderStats()).
+ */
+struct RenderStats {
+    std::size_t commands = 0;         ///< Comandos que pasaron por la cola
+    std::size_t drawCalls = 0;        ///< Llamadas a draw() (de la cola y directas)
+    std::size_t vertices = 0;         ///< Vértices enviados (los de drawables directos no se conocen)
+    std::size_t textureSwitches = 0;  ///< Cambios de textura entre draws de textura conocida
+};
+
+/**
+ * @class RenderQueue
+ * @brief Los componentes envían aquí lo que quieren dibujar; Window::flush() lo ordena y lo dibuja.
+ *
+ * Clave de 64 bits: capa (4) | profundidad (32) | grupo (28). Dentro de una capa se dibuja de
+ * menor a mayor profundidad (float completo, sin perder precisión). A igual profundidad el grupo
+ * decide según el RenderSort de la capa:
+ * - Submission (por defecto): orden de envío (20 bits), así los draws que se solapan no cambian
+ *   de orden.
+ * - Texture: textura del frame (8 bits) y después orden de envío, para reducir cambios de textura.
+ *   Solo es correcto en capas cuyos draws de igual profundidad no se solapen.
+ *
+ * Hay 2^20 órdenes de envío por frame y 255 texturas distinguibles; los que sobran comparten el
+ * último valor (siguen dibujándose, pero sin orden garantizado entre ellos).
+ *
+ * Los arreglos se reutilizan entre frames: tras el primero, enviar y ordenar no asignan.
+ */
+class RenderQueue {
+public:
+    /** @brief Sprite (4 vértices, su textura). */
+    void submit(RenderLayer layer, float depth, const sf::Sprite& sprite);
+
+    /** @brief Shape (relleno + contorno, su textura si tiene). */
+    void submit(RenderLayer layer, float depth, const sf::Shape& shape);
+
+    /**
+     * @brief Cualquier drawable (VertexBuffer, texto...). texture y vertexCount son informativos:
+     * ordenan y alimentan las estadísticas.
+     */
+    void submit(RenderLayer layer, float depth, const sf::Drawable& drawable,
+        const sf::Texture* texture, std::size_t vertexCount);
+
+    /** @brief Arreglo de vértices con una textura opcional (lotes de SpriteBatch, DebugGeometry). */
+    void submit(RenderLayer layer, float depth, const sf::Vertex* vertices, std::size_t vertexCount,
+        sf::PrimitiveType primitive, const sf::Texture* texture = nullptr);
+
+    /**
+     * @brief Cambia el orden dentro de una profundidad para los comandos que se envíen después
+     * a esa capa. Se conserva entre frames.
+     */
+    void setSortMode(RenderLayer layer, RenderSort mode) { m_sortModes[std::size_t(layer) & 0xFu] = mode; }
+    RenderSort getSortMode(RenderLayer layer) const { return m_sortModes[std::size_t(layer) & 0xFu]; }
+
+    /** @brief Ordena los comandos por clave. */
+    void sort();
+
+    /** @brief Vacía la cola (conserva la capacidad). */
+    void clear();
+
+    const std::vector<RenderCommand>& getCommands() const { return m_commands; }
+    std::size_t size() const { return m_commands.size(); }
+    bool empty() const { return m_commands.empty(); }
+
+    /**
+     * @brief Compone una clave. depth se convierte a entero conservando el orden de los float;
+     * textureId solo cuenta si mode es RenderSort::Texture.
+     */
+    static std::uint64_t makeKey(RenderLayer layer, float depth, std::uint32_t textureId, std::uint32_t sequence,
+        RenderSort mode = RenderSort::Submission);
+
+private:
+    void push(RenderLayer layer, float depth, RenderCommand command);
+    std::uint32_t textureId(const sf::Texture* texture);
+
+    std::vector<RenderCommand> m_commands;
+    std::vector<const sf::Texture*> m_textures;   ///< Id de textura del frame = índice + 1 (0 = ninguna)
+    std::array<RenderSort, 16> m_sortModes{};     ///< Por capa (4 bits); todas Submission al inicio
+};
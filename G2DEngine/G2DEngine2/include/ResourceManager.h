@@ -2,7 +2,9 @@
 
 #include <Prerequisites.h>
 #include <unordered_map>
+#include <vector>
 #include <ECS/Texture.h>
+#include <TextureAtlas.h>
 
 class ResourceManager {
 public:
@@ -14,6 +16,23 @@ public:
 	 */
 	bool loadTexture(const std::string& fileName, const std::string& extension = "png");
 
+	/**
+	 * @brief Carga varios sprites empaquetados en las pginas de un TextureAtlas.
+	 *
+	 * Cada sprite queda en getTexture(fileName) como una Texture que apunta a su zona de la pgina,
+	 * as que los que comparten pgina se dibujan con un solo draw en SpriteBatch. Los que no entran
+	 * en el atlas (demasiado grandes) se cargan sueltos con loadTexture().
+	 * @param fileNames Nombres base de los archivos (sin extensin).
+	 * @param extension Extensin comn (por defecto "png").
+	 * @param cacheDir Carpeta donde se guarda la distribucin del atlas; vaca para no usar cach.
+	 * @return true si todos los sprites quedaron cargados.
+	 */
+	bool loadAtlas(const std::vector<std::string>& fileNames, const std::string& extension = "png",
+		const std::string& cacheDir = "bin/Cache");
+
+	/** @brief Atlas de la ltima loadAtlas(). */
+	const TextureAtlas& getAtlas() const { return m_atlas; }
+
 	/**
 	 * @brief Devuelve la textura cargada con fileName, o la textura por defecto si no existe.
 	 */
@@ -22,4 +41,7 @@ public:
 private:
 	// Mapa de texturas cargadas: clave = fileName, valor = puntero compartido a Texture
 	std::unordered_map<std::string, EngineUtilities::TSharedPointer<Texture>> m_textures;
+
+	// Pginas de los sprites cargados con loadAtlas()
+	TextureAtlas m_atlas;
 };
\ No newline at end of file
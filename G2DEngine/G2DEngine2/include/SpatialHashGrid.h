@@ -0,0 +1,105 @@
+#pragma once
+
+/**
+ * @file SpatialHashGrid.h
+ * @brief Rejilla uniforme para consultas de proximidad entre corredores.
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
+/**
+ * @class SpatialHashGrid
+ * @brief Reparte puntos en celdas cuadradas de lado fijo y responde consultas por radio y de
+ * los k más cercanos mirando solo las celdas que tocan la consulta.
+ *
+ * build() se llama una vez por paso con las posiciones de todos los corredores: ajusta la
+ * rejilla a su caja envolvente y los ordena por celda con un counting sort (O(n), sin
+ * asignaciones una vez que los arreglos alcanzaron su tamaño). Los puntos se identifican por su
+ * índice en los arreglos que se pasaron a build().
+ *
+ * Con el lado de celda del orden del radio de consulta, una consulta revisa 4-9 celdas y su
+ * coste depende de la densidad local, no del número total de corredores. Si los puntos están
+ * tan dispersos que harían falta más de ~4 celdas por punto, build() agranda las celdas.
+ */
+class SpatialHashGrid {
+public:
+    using Index = std::uint32_t;
+    static constexpr Index InvalidIndex = ~Index(0);
+
+    /**
+     * @param cellSize Lado de cada celda (px); conviene que sea similar al radio de consulta.
+     */
+    explicit SpatialHashGrid(float cellSize = 32.f) { setCellSize(cellSize); }
+
+    void setCellSize(float cellSize) { m_cellSize = cellSize > 1e-3f ? cellSize : 1e-3f; }
+    float getCellSize() const { return m_cellSize; }
+
+    /**
+     * @brief Reconstruye la rejilla con count puntos (xs[i], ys[i]).
+     */
+    void build(const float* xs, const float* ys, std::size_t count);
+
+    /** @brief Puntos de la última build(). */
+    std::size_t size() const { return m_x.size(); }
+
+    sf::Vector2f getPoint(Index i) const { return { m_x[i], m_y[i] }; }
+
+    /**
+     * @brief Llama fn(index, dist2) por cada punto a distancia <= radius de pos.
+     */
+    template<typename Fn>
+    void forEachInRadius(const sf::Vector2f& pos, float radius, Fn&& fn) const {
+        if (m_x.empty() || radius < 0.f) return;
+        const float r2 = radius * radius;
+        const int cx0 = cellX(pos.x - radius), cx1 = cellX(pos.x + radius);
+        const int cy0 = cellY(pos.y - radius), cy1 = cellY(pos.y + radius);
+        for (int cy = cy0; cy <= cy1; ++cy) {
+            for (int cx = cx0; cx <= cx1; ++cx) {
+                const std::size_t cell = std::size_t(cy) * std::size_t(m_cols) + std::size_t(cx);
+                for (Index k = m_cellStart[cell]; k < m_cellStart[cell + 1]; ++k) {
+                    const Index i = m_entries[k];
+                    const float dx = m_x[i] - pos.x, dy = m_y[i] - pos.y;
+                    const float d2 = dx * dx + dy * dy;
+                    if (d2 <= r2) fn(i, d2);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Índices de los puntos a distancia <= radius de pos.
+     * @return Número de puntos encontrados (out se vacía antes).
+     */
+    std::size_t queryRadius(const sf::Vector2f& pos, float radius, std::vector<Index>& out) const;
+
+    /**
+     * @brief Los k puntos más cercanos a pos (del más cercano al más lejano), sin pasar de maxRadius.
+     * @param exclude Índice a ignorar (p.ej. el propio corredor).
+     * @return Número de puntos encontrados (<= k; out se vacía antes).
+     */
+    std::size_t nearestK(const sf::Vector2f& pos, std::size_t k, std::vector<Index>& out,
+        float maxRadius = 1e9f, Index exclude = InvalidIndex) const;
+
+private:
+    int cellX(float x) const { return clampCell(int(std::floor((x - m_originX) * m_invStep)), m_cols); }
+    int cellY(float y) const { return clampCell(int(std::floor((y - m_originY) * m_invStep)), m_rows); }
+    static int clampCell(int c, int count) { return c < 0 ? 0 : (c >= count ? count - 1 : c); }
+
+    float m_cellSize = 32.f;
+    float m_invStep = 1.f / 32.f;         ///< 1 / lado efectivo (mayor que m_cellSize si hay demasiadas celdas)
+    float m_originX = 0.f, m_originY = 0.f;
+    int m_cols = 1, m_rows = 1;
+
+    std::vector<float> m_x, m_y;          ///< Copia de las posiciones de build()
+    std::vector<Index> m_cellOf;          ///< Celda de cada punto
+    std::vector<Index> m_cellStart;       ///< Inicio de cada celda en m_entries (celdas + 1)
+    std::vector<Index> m_entries;         ///< Índices de puntos agrupados por celda
+
+    mutable std::vector<std::pair<float, Index>> m_candidates; ///< Temporal de nearestK()
+};
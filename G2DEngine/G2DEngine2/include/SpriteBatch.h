@@ -0,0 +1,106 @@
+#pragma once
+
+/**
+ * @file SpriteBatch.h
+ * @brief Agrupa los sprites del frame por textura para dibujarlos con un draw por textura.
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "RenderQueue.h"
+
+namespace sf {
+    class Sprite;
+    class Texture;
+}
+
+class Window;
+
+/**
+ * @class SpriteBatch
+ * @brief Acumula los quads de todos los sprites visibles del frame en un arreglo de vértices
+ * por textura y los dibuja con una sola llamada a Window::draw() por textura.
+ *
+ * Posición, rotación, escala y origen se aplican en CPU al generar los 4 vértices (2 triángulos,
+ * SFML 3 no tiene quads), así que todos los sprites de una textura comparten estado de render.
+ * Los arreglos se reutilizan entre frames: después del primero, begin()/add()/flush() no asignan.
+ *
+ * Los lotes se dibujan en el orden en que apareció cada textura por primera vez en el frame; dentro
+ * de un lote se respeta el orden de add(). Sprites de texturas distintas que se solapen pueden
+ * quedar en otro orden que con un draw por sprite.
+ */
+class SpriteBatch {
+public:
+    /**
+     * @brief Contadores del último flush().
+     */
+    struct Stats {
+        std::size_t sprites = 0;   ///< Sprites añadidos
+        std::size_t culled = 0;    ///< Sprites descartados por quedar fuera de la vista
+        std::size_t batches = 0;   ///< Texturas distintas = draws emitidos
+    };
+
+    /**
+     * @brief Empieza un frame: vacía los lotes (conserva su capacidad).
+     * @param view Zona visible en coordenadas de mundo; los sprites que no la tocan se descartan.
+     *        Con tamaño 0 no se descarta nada.
+     */
+    void begin(const sf::FloatRect& view = {});
+
+    /**
+     * @brief Añade un quad texturizado.
+     * @param texture Textura del lote (debe seguir viva hasta flush()).
+     * @param textureRect Zona de la textura, en píxeles.
+     * @param position Posición del origen en el mundo.
+     * @param rotationDeg Rotación en grados alrededor del origen.
+     * @param scale Escala (x, y).
+     * @param origin Origen local, en píxeles del rectángulo.
+     */
+    void add(const sf::Texture& texture, const sf::IntRect& textureRect, const sf::Vector2f& position,
+        float rotationDeg, const sf::Vector2f& scale, const sf::Vector2f& origin,
+        sf::Color color = sf::Color::White);
+
+    /**
+     * @brief Añade un sprite con su textura, rectángulo, transform y color actuales.
+     */
+    void add(const sf::Sprite& sprite);
+
+    /**
+     * @brief Dibuja cada lote con un solo draw y actualiza getStats().
+     */
+    void flush(Window& window);
+
+    /**
+     * @brief Como flush(), pero encola cada lote (un comando por textura) en lugar de dibujarlo.
+     * Los vértices siguen siendo del lote: queue debe vaciarse antes del siguiente begin().
+     */
+    void submit(RenderQueue& queue, RenderLayer layer, float depth = 0.f);
+
+    /** @brief Lotes del frame en curso (draws que emitirá flush()). */
+    std::size_t getBatchCount() const { return m_used; }
+
+    /** @brief Contadores del último flush(). */
+    const Stats& getStats() const { return m_stats; }
+
+private:
+    struct Batch {
+        const sf::Texture* texture = nullptr;
+        std::vector<sf::Vertex> vertices;
+    };
+
+    Batch& batchFor(const sf::Texture& texture);
+    void recordStats();
+
+    std::vector<Batch> m_batches;   ///< Se reutilizan; solo los primeros m_used están activos
+    std::size_t m_used = 0;
+    std::size_t m_lastBatch = 0;    ///< Lote del último add() (los sprites suelen venir agrupados)
+    sf::FloatRect m_view;
+    std::size_t m_sprites = 0, m_culled = 0;
+    Stats m_stats;
+};
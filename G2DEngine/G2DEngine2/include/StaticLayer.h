@@ -0,0 +1,96 @@
+#pragma once
+
+/**
+ * @file StaticLayer.h
+ * @brief Capa de fondo que dibuja los actores estáticos una vez en una RenderTexture y la reutiliza.
+ */
+
+#include <Prerequisites.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include "RenderQueue.h"
+
+class Actor;
+class DebugGeometry;
+class Window;
+
+/**
+ * @class StaticLayer
+ * @brief Hornea actores que casi nunca cambian (la pista, sus tiles) y geometría de depuración
+ * fija en una RenderTexture del tamaño de la ventana; cada frame solo dibuja esa textura con un draw.
+ *
+ * La capa se vuelve a hornear cuando cambia la versión del Transform o de la CShape de algún actor,
+ * el contador de cambios de alguna DebugGeometry, la vista o el tamaño de la ventana, o cuando se
+ * llama a invalidate() (p. ej. tras cambiar la Texture de un actor, que no lleva versión).
+ *
+ * Si la RenderTexture no se puede crear, render() dibuja todo directamente cada frame.
+ */
+class StaticLayer {
+public:
+    /** @brief Añade un actor a la capa (se dibuja con Actor::renderTo(), en orden de inserción). */
+    void addActor(const EngineUtilities::TSharedPointer<Actor>& actor);
+
+    /** @brief Añade geometría que se dibuja encima de los actores. Debe vivir más que la capa. */
+    void addGeometry(const DebugGeometry& geometry);
+
+    /** @brief Quita todo el contenido. */
+    void clear();
+
+    /** @brief Fuerza a volver a hornear en el siguiente render(). */
+    void invalidate() { m_dirty = true; }
+
+    /**
+     * @brief Hornea si hace falta y dibuja la capa en la ventana (un draw).
+     */
+    void render(const EngineUtilities::TSharedPointer<Window>& window);
+
+    /**
+     * @brief Como render(), pero encola la capa en queue (un comando). Si no hay RenderTexture
+     * encola el contenido: cada actor con su capa y la geometría en layer con depth + 1.
+     */
+    void submit(RenderQueue& queue, Window& window, RenderLayer layer, float depth = 0.f);
+
+    /** @brief Veces que se horneó la capa (para comprobar que la caché funciona). */
+    std::size_t getBakeCount() const { return m_bakes; }
+
+    /** @brief false si no hubo RenderTexture y la capa se dibuja directamente. */
+    bool isCached() const { return !m_unavailable; }
+
+private:
+    struct ActorEntry {
+        EngineUtilities::TSharedPointer<Actor> actor;
+        std::uint32_t transformVersion = 0;
+        std::uint32_t shapeVersion = 0;
+    };
+
+    struct GeometryEntry {
+        const DebugGeometry* geometry = nullptr;
+        std::size_t changes = 0;
+    };
+
+    bool isStale(const sf::View& view, sf::Vector2u size) const;
+    void bake(const sf::View& view, sf::Vector2u size);
+    void renderDirect(const EngineUtilities::TSharedPointer<Window>& window);
+    void submitDirect(RenderQueue& queue, RenderLayer layer, float depth);
+
+    /** @brief Hornea si hace falta y deja m_blit listo; false si no hay RenderTexture. */
+    bool prepare(Window& window);
+
+    std::vector<ActorEntry> m_actors;
+    std::vector<GeometryEntry> m_geometry;
+
+    sf::RenderTexture m_texture;
+    std::optional<sf::Sprite> m_blit;          ///< Sprite que cubre la vista con la textura horneada
+    sf::Vector2f m_bakedCenter, m_bakedSize;   ///< Vista con la que se horneó
+    bool m_dirty = true;
+    bool m_unavailable = false;
+    std::size_t m_bakes = 0;
+};
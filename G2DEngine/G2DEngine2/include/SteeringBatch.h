@@ -0,0 +1,94 @@
+#pragma once
+
+/**
+ * @file SteeringBatch.h
+ * @brief Path following (pure pursuit) de muchos corredores a la vez, en arreglos SoA.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
+/**
+ * @class SteeringBatch
+ * @brief Reúne el estado de steering de todos los corredores activos y lo avanza en lote.
+ *
+ * steerOne() es el paso de un solo corredor (el que usa A_Racer::doPathFollowing).
+ * stepScalar() lo aplica a cada entrada del lote; stepSimd() procesa los corredores de 4 en 4
+ * con SSE2 y da el mismo resultado dentro de una tolerancia: raíces en precisión simple en
+ * lugar de std::hypot y un atan2 polinómico (error < 1e-5 rad, < 1e-3 grados).
+ *
+ * Uso: clear(), add() por corredor, stepScalar()/stepSimd(), y leer posición, rotación y
+ * waypoint de cada entrada para escribirlos de vuelta en el corredor.
+ */
+class SteeringBatch {
+public:
+    /**
+     * @brief Parámetros de steering de un corredor.
+     */
+    struct Params {
+        float maxSpeed;      ///< Velocidad máxima (px/s)
+        float lookahead;     ///< Distancia de persecución (pure pursuit)
+        float arriveRadius;  ///< Radio para cambiar de waypoint
+    };
+
+    /**
+     * @brief Avanza un corredor dt segundos sobre su ruta cerrada.
+     * @param path Puntos de la ruta (al menos 2).
+     * @param pathSize Número de puntos.
+     * @param waypoint Waypoint actual; se actualiza si el corredor pasa al siguiente segmento.
+     * @param pos Posición; se actualiza si el corredor se mueve.
+     * @param rotationDeg Rotación en grados; se actualiza si el corredor se mueve.
+     * @return true si el corredor se movió (posición y rotación cambiaron).
+     */
+    static bool steerOne(const sf::Vector2f* path, int pathSize, int& waypoint,
+        sf::Vector2f& pos, float& rotationDeg, const Params& params, float dt);
+
+    /**
+     * @brief Indica si stepSimd() usa SIMD en esta compilación (si no, equivale a stepScalar()).
+     */
+    static bool hasSimd();
+
+    /** @brief Vacía el lote (conserva la capacidad). */
+    void clear();
+
+    /** @brief Reserva capacidad para count corredores. */
+    void reserve(std::size_t count);
+
+    /**
+     * @brief Añade un corredor; path debe seguir siendo válido hasta leer los resultados.
+     * @return Índice del corredor dentro del lote.
+     */
+    std::size_t add(const sf::Vector2f* path, int pathSize, int waypoint,
+        const sf::Vector2f& pos, float rotationDeg, const Params& params);
+
+    /** @brief Avanza todo el lote con steerOne(), corredor a corredor. */
+    void stepScalar(float dt);
+
+    /** @brief Avanza todo el lote de 4 en 4 con SSE2 (el resto con steerOne()). */
+    void stepSimd(float dt);
+
+    std::size_t size() const { return m_posX.size(); }
+
+    sf::Vector2f getPosition(std::size_t i) const { return { m_posX[i], m_posY[i] }; }
+    float getRotation(std::size_t i) const { return m_rotation[i]; }
+    int getWaypoint(std::size_t i) const { return m_waypoint[i]; }
+
+    /** @brief true si el corredor i se movió en el último paso. */
+    bool moved(std::size_t i) const { return m_moved[i] != 0; }
+
+private:
+    void stepRange(std::size_t begin, std::size_t end, float dt);
+
+    std::vector<float> m_posX, m_posY;
+    std::vector<float> m_rotation;
+    std::vector<std::int32_t> m_waypoint;
+    std::vector<std::int32_t> m_pathSize;
+    std::vector<const sf::Vector2f*> m_path;
+    std::vector<float> m_maxSpeed;
+    std::vector<float> m_lookahead;
+    std::vector<float> m_arriveRadius;
+    std::vector<std::uint8_t> m_moved;
+};
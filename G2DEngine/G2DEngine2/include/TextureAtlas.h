@@ -0,0 +1,116 @@
+#pragma once
+
+/**
+ * @file TextureAtlas.h
+ * @brief Empaqueta los sprites pequeños en unas pocas texturas grandes (páginas) al cargarlos.
+ */
+
+#include <Prerequisites.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Vector2.hpp>
+
+namespace sf {
+    class Image;
+}
+
+/**
+ * @class TextureAtlas
+ * @brief Atlas de sprites construido en la carga con el empaquetador de rectángulos de stb
+ * (imstb_rectpack.h, el mismo que usa ImGui para su atlas de fuentes).
+ *
+ * Cada sprite se copia a una página de como mucho maxPageSize x maxPageSize px, con padding px
+ * transparentes alrededor para que el filtrado no mezcle vecinos. Los sprites que ocupan más de
+ * maxSpriteSize en algún eje (fondos, la pista) no se empaquetan y se cargan sueltos.
+ *
+ * La distribución y las páginas ya compuestas se guardan en cacheDir (atlas.layout y
+ * atlas_<n>.png). En la siguiente carga, si ningún archivo cambió de tamaño ni de fecha, las páginas
+ * se leen de la caché y no se decodifica ni empaqueta ningún sprite.
+ */
+class TextureAtlas {
+public:
+    /**
+     * @brief Límites del empaquetado. Forman parte de la clave de la caché.
+     */
+    struct Options {
+        int maxPageSize = 2048;   ///< Lado máximo de una página, en píxeles
+        int padding = 2;          ///< Píxeles transparentes entre sprites y en el borde
+        int maxSpriteSize = 512;  ///< Los sprites más grandes en algún eje se quedan fuera
+    };
+
+    /**
+     * @brief Posición de un sprite dentro del atlas.
+     */
+    struct Entry {
+        std::string name;        ///< Nombre base (sin extensión), igual que en ResourceManager
+        int page = -1;           ///< Página; -1 si el sprite no se empaquetó
+        sf::IntRect rect;        ///< Zona del sprite en la página (sin padding)
+    };
+
+    /**
+     * @brief Resultado de pack(): página y esquina de cada tamaño, y tamaño final de cada página.
+     */
+    struct Layout {
+        std::vector<int> pages;                 ///< Página de cada rectángulo (-1 = no cabe)
+        std::vector<sf::Vector2i> positions;    ///< Esquina superior izquierda, ya con el padding
+        std::vector<sf::Vector2i> pageSizes;    ///< Recortadas a la zona usada
+    };
+
+    TextureAtlas() = default;
+    explicit TextureAtlas(const Options& options) : m_options(options) {}
+
+    /**
+     * @brief Construye el atlas con bin/<name>.<extension> de cada nombre, o lo lee de la caché.
+     * @param fileNames Nombres base de los sprites.
+     * @param extension Extensión común ("png").
+     * @param cacheDir Carpeta de la caché; vacía para no usarla.
+     * @return true si quedó al menos una página.
+     */
+    bool build(const std::vector<std::string>& fileNames, const std::string& extension = "png",
+        const std::string& cacheDir = "bin/Cache");
+
+    /** @brief Entrada del sprite name, o nullptr si no se pidió en build(). */
+    const Entry* find(const std::string& name) const;
+
+    /** @brief Textura de la página index (compartida por todos sus sprites). */
+    EngineUtilities::TSharedPointer<sf::Texture> getPage(int index) const;
+
+    std::size_t getPageCount() const { return m_pages.size(); }
+    const std::vector<Entry>& getEntries() const { return m_entries; }
+
+    /** @brief true si el último build() leyó las páginas de la caché. */
+    bool wasLoadedFromCache() const { return m_fromCache; }
+
+    /**
+     * @brief Reparte rectángulos de los tamaños dados en páginas con stb_rect_pack.
+     *
+     * No toca SFML: solo calcula la distribución. Los rectángulos que no caben en una página vacía
+     * quedan con página -1.
+     */
+    static Layout pack(const std::vector<sf::Vector2i>& sizes, int maxPageSize, int padding);
+
+private:
+    /** @brief Tamaño y fecha de un archivo fuente, para invalidar la caché. */
+    struct SourceStamp {
+        std::string name;
+        std::uintmax_t bytes = 0;
+        std::int64_t modified = 0;
+    };
+
+    bool loadCache(const std::string& cacheDir, const std::vector<SourceStamp>& stamps);
+    bool saveCache(const std::string& cacheDir, const std::vector<SourceStamp>& stamps,
+        const std::vector<sf::Image>& pageImages) const;
+    void clear();
+
+    Options m_options;
+    std::vector<Entry> m_entries;
+    std::unordered_map<std::string, std::size_t> m_index;
+    std::vector<EngineUtilities::TSharedPointer<sf::Texture>> m_pages;
+    bool m_fromCache = false;
+};
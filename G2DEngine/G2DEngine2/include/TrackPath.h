@@ -0,0 +1,118 @@
+#pragma once
+
+/**
+ * @file TrackPath.h
+ * @brief Ruta cerrada parametrizada por longitud de arco.
+ */
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
+#include "Memory/TSharedPointer.h"
+
+/**
+ * @class TrackPath
+ * @brief Polilínea cerrada con las longitudes acumuladas de sus segmentos precalculadas.
+ *
+ * El segmento i va de points()[i] a points()[(i + 1) % size()]; la ruta tiene size() segmentos
+ * y una longitud totalLength(). Las distancias se miden desde points()[0] a lo largo de la ruta.
+ *
+ * - pointAt(d) busca el segmento con búsqueda binaria (O(log n)).
+ * - distanceAlong(pos, hint) proyecta pos sobre los segmentos vecinos a hint (O(1)); sin hint
+ *   recorre toda la ruta (O(n)), lo que solo hace falta al colocar un corredor.
+ *
+ * Es inmutable: los corredores comparten una sola instancia a través de TrackPath::Ptr y cada
+ * uno sigue el carril lane(offset). Los carriles se calculan la primera vez que se piden y
+ * quedan en caché dentro de la ruta base, uno por offset distinto.
+ *
+ * Hilos: lane() es thread-safe (la caché está protegida por un mutex) y el resto de consultas
+ * son const sin estado mutable. Ptr, en cambio, usa el recuento no atómico de TSharedPointer:
+ * copiar o soltar Ptr de una misma ruta desde varios hilos a la vez es una carrera. Por eso cada
+ * hilo de BatchRunner construye su propia ruta (RaceWorld::setPath) en lugar de compartir una.
+ */
+class TrackPath {
+public:
+    /** @brief Segmentos a cada lado del hint que revisa distanceAlong(). */
+    static constexpr int kHintWindow = 1;
+
+    /** @brief Referencia compartida (conteo no atómico: no copiar entre hilos) a una ruta inmutable. */
+    using Ptr = EngineUtilities::TSharedPointer<const TrackPath>;
+
+    TrackPath() = default;
+    explicit TrackPath(std::vector<sf::Vector2f> points);
+
+    /** @brief Crea una ruta compartida a partir de sus puntos. */
+    static Ptr create(std::vector<sf::Vector2f> points);
+
+    /** @brief Ruta vacía compartida por todos (para referencias que aún no tienen ruta). */
+    static const TrackPath& emptyPath();
+
+    /**
+     * @brief Carril paralelo desplazado offsetPx a la izquierda (ver offsetPoints()).
+     *
+     * Devuelve *this para offset 0. La primera petición de cada offset lo calcula (O(n)); las
+     * siguientes devuelven el mismo carril. La referencia vive lo mismo que esta ruta.
+     * Thread-safe (toma el mutex de la caché; no está en la ruta caliente).
+     */
+    const TrackPath& lane(float offsetPx) const;
+
+    /**
+     * @brief Offset lateral de una polilínea cerrada usando bisectriz (más suave en curvas).
+     */
+    static std::vector<sf::Vector2f> offsetPoints(const std::vector<sf::Vector2f>& path, float offsetPx);
+
+    const std::vector<sf::Vector2f>& points() const { return m_points; }
+    int size() const { return (int)m_points.size(); }
+    bool empty() const { return m_points.empty(); }
+
+    /** @brief Longitud de la ruta cerrada (0 si tiene menos de 2 puntos). */
+    float totalLength() const { return m_cumulative.empty() ? 0.f : m_cumulative.back(); }
+
+    /** @brief Distancia desde el inicio de la ruta hasta el comienzo del segmento. */
+    float segmentStart(int segment) const { return m_cumulative[segment]; }
+
+    /** @brief Longitud del segmento. */
+    float segmentLength(int segment) const { return m_cumulative[segment + 1] - m_cumulative[segment]; }
+
+    /**
+     * @brief Lleva una distancia cualquiera (negativa o de varias vueltas) a [0, totalLength()).
+     */
+    float wrap(float distance) const;
+
+    /**
+     * @brief Segmento que contiene la distancia (se envuelve antes). Búsqueda binaria.
+     */
+    int segmentAt(float distance) const;
+
+    /**
+     * @brief Punto de la ruta a esa distancia del inicio (se envuelve antes).
+     */
+    sf::Vector2f pointAt(float distance) const;
+
+    /**
+     * @brief Distancia a lo largo de la ruta del punto más cercano a pos.
+     * @param pos Posición a proyectar.
+     * @param hintSegment Segmento donde estaba pos la última vez; solo se revisan los
+     *        kHintWindow segmentos a cada lado. Con -1 se revisa la ruta completa.
+     * @param outSegment Si no es nulo, recibe el segmento elegido (el hint para la próxima vez).
+     * @return Distancia en [0, totalLength()); 0 si la ruta tiene menos de 2 puntos.
+     */
+    float distanceAlong(const sf::Vector2f& pos, int hintSegment = -1, int* outSegment = nullptr) const;
+
+private:
+    /** Proyecta pos sobre el segmento; devuelve t en [0, 1] y la distancia al cuadrado. */
+    float project(int segment, const sf::Vector2f& pos, float& dist2) const;
+
+    struct Lane {
+        float offset;
+        EngineUtilities::TSharedPointer<TrackPath> path;
+    };
+
+    std::vector<sf::Vector2f> m_points;
+    std::vector<float> m_cumulative;   ///< size() + 1 entradas: m_cumulative[i] = inicio del segmento i
+    mutable std::vector<Lane> m_lanes; ///< Caché de lane(); no cambia la ruta en sí
+    mutable std::mutex m_lanesMutex;   ///< Protege m_lanes
+};
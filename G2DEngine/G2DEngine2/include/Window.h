@@ -2,10 +2,11 @@
 
 #include "Prerequisites.h"
 #include "Memory/TUniquePtr.h"
+#include "RenderQueue.h"
 
 #include <SFML/Window.hpp>
 #include <SFML/Graphics.hpp> // sf::RenderWindow, sf::Drawable, sf::Color
-#include <functional>
+#include <cstddef>
 #include <string>
 
 /**
@@ -34,9 +35,32 @@ public:
 
     /**
      * @brief Procesa los eventos pendientes de SFML.
-     * @param callback Función opcional llamada por cada evento recibido.
+     * @param callback Invocable llamado por cada evento recibido.
+     *
+     * Es plantilla para no envolver el lambda en std::function, que con capturas grandes
+     * reserva memoria en cada frame.
      */
-    void handleEvents(const std::function<void(const sf::Event&)>& callback = nullptr);
+    template<typename Callback>
+    void handleEvents(Callback&& callback) {
+        if (!m_windowPtr) return;
+
+        // En SFML 3, pollEvent() retorna std::optional<sf::Event>
+        while (auto event = m_windowPtr->pollEvent()) {
+            callback(*event);
+
+            // Cierre de ventana solicitado
+            if (event->is<sf::Event::Closed>()) {
+                close();
+            }
+        }
+    }
+
+    /**
+     * @brief Procesa los eventos pendientes de SFML sin callback de usuario.
+     */
+    void handleEvents() {
+        handleEvents([](const sf::Event&) {});
+    }
 
     /**
      * @brief Indica si la ventana sigue abierta.
@@ -58,11 +82,41 @@ public:
     void draw(const sf::Drawable& drawable,
         const sf::RenderStates& states = sf::RenderStates::Default);
 
+    /**
+     * @brief Dibuja un arreglo de vértices sin pasar por sf::VertexArray.
+     * @param vertices Puntero al primer vértice (p.ej. los de una DebugGeometry sin vertex buffer).
+     * @param vertexCount Número de vértices.
+     * @param type Tipo de primitiva (LineStrip, Triangles...).
+     * @param states Estados de render opcionales.
+     */
+    void draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+        const sf::RenderStates& states = sf::RenderStates::Default);
+
+    /**
+     * @brief Ordena la cola por clave, dibuja cada comando y la vacía.
+     * Sin ventana solo vacía la cola (no cuenta estadísticas).
+     * @param queue Comandos del frame (ver RenderQueue para el orden).
+     */
+    void flush(RenderQueue& queue);
+
     /**
      * @brief Intercambia buffers y presenta en pantalla.
      */
     void display();
 
+    /**
+     * @brief Llamadas a draw() del último frame presentado (las de ImGui no pasan por aquí).
+     */
+    std::size_t getDrawCalls() const { return m_lastFrameStats.drawCalls; }
+
+    /**
+     * @brief Estadísticas del último frame presentado: comandos, draws, vértices y cambios de textura.
+     *
+     * Los vértices y cambios de textura solo se conocen en los draws que pasan por la cola o por
+     * draw(vertices...); un draw(drawable) directo solo suma a drawCalls.
+     */
+    const RenderStats& getRenderStats() const { return m_lastFrameStats; }
+
     /**
      * @brief Actualiza el delta time interno (debe llamarse una vez por frame).
      */
@@ -109,4 +163,16 @@ private:
      * @brief Reloj interno para calcular deltaTime.
      */
     sf::Clock clock;
+
+    /**
+     * @brief Cuenta un cambio de textura si texture no es la enlazada por el draw anterior.
+     */
+    void noteTexture(const sf::Texture* texture);
+
+    /**
+     * @brief Estadísticas del frame en curso y del último presentado (display() las rota).
+     */
+    RenderStats m_frameStats;
+    RenderStats m_lastFrameStats;
+    const sf::Texture* m_boundTexture = nullptr; ///< Textura del último draw de textura conocida
 };
\ No newline at end of file
@@ -3,21 +3,19 @@
 #include <cmath>
 #include <algorithm>
 
-static inline float vlen(const sf::Vector2f& v) {
-    return std::sqrt(v.x * v.x + v.y * v.y);
-}
-static inline sf::Vector2f vnorm(const sf::Vector2f& v) {
-    float L = vlen(v);
-    return (L > 1e-5f) ? sf::Vector2f{ v.x / L, v.y / L } : sf::Vector2f{ 0.f, 0.f };
-}
-static inline float clamp01(float x) { return std::max(0.f, std::min(1.f, x)); }
-
 A_Racer::A_Racer(const std::string& name, int /* playerId */)
     : Actor(name) {
 }
 
 void A_Racer::setPath(const std::vector<sf::Vector2f>& pathPoints) {
-    path = pathPoints;
+    setTrack(TrackPath::create(pathPoints));
+}
+
+void A_Racer::setTrack(const TrackPath::Ptr& track, float laneOffset) {
+    m_sharedTrack = track;
+    m_laneOffset = laneOffset;
+    m_track = track ? &track->lane(laneOffset) : &TrackPath::emptyPath();
+    const auto& path = m_track->points();
 
     if (!path.empty()) {
         if (auto xf = getComponent<Transform>()) {
@@ -26,6 +24,9 @@ void A_Racer::setPath(const std::vector<sf::Vector2f>& pathPoints) {
         }
     }
     currentWaypointIndex = (path.size() > 1 ? 1 : 0);
+    m_trackDistance = 0.f;
+    m_trackLaps = 0;
+    updateFinishGate();
 
     // <-- sincroniza sprite con el Transform inicial
     Actor::update(0.f);
@@ -33,9 +34,10 @@ void A_Racer::setPath(const std::vector<sf::Vector2f>& pathPoints) {
 
 void A_Racer::reset() {
     m_currentLap = 0;
+    m_lapCrossFraction = 1.f;
     m_place = 0;
-    m_crossedLastFrame = false;
 
+    const auto& path = m_track->points();
     if (!path.empty()) {
         if (auto xf = getComponent<Transform>()) {
             xf->setPosition(path.front());
@@ -43,99 +45,126 @@ void A_Racer::reset() {
         }
     }
     currentWaypointIndex = (path.size() > 1 ? 1 : 0);
+    m_trackDistance = 0.f;
+    m_trackLaps = 0;
+    updateFinishGate();
 
     // <-- sincroniza sprite tras el reset
     Actor::update(0.f);
 }
 
 float A_Racer::getProgress() const {
-    // Progreso dentro de la vuelta (0..1)
-    const int N = (int)path.size();
-    if (N < 2) return 0.f;
+    // Progreso dentro de la vuelta (0..1), proporcional a la distancia recorrida
+    const float total = m_track->totalLength();
+    return total > 0.f ? m_trackDistance / total : 0.f;
+}
 
-    auto xf = const_cast<A_Racer*>(this)->getComponent<Transform>();
-    sf::Vector2f pos = xf ? xf->getPosition() : path.front();
+void A_Racer::updateTrackDistance() {
+    auto xf = getComponentPtr<Transform>();
+    if (!xf || m_track->size() < 2) return;
+    // El steering persigue el segmento currentWaypointIndex; el coche est en l o en los vecinos
+    const float previous = m_trackDistance;
+    m_trackDistance = m_track->distanceAlong(xf->getPosition(), currentWaypointIndex);
+
+    // Un salto de ms de media ruta es un paso por el inicio del trazado
+    const float half = m_track->totalLength() * 0.5f;
+    if (m_trackDistance - previous < -half) ++m_trackLaps;
+    else if (m_trackDistance - previous > half) --m_trackLaps;
+}
 
-    const int cur = (currentWaypointIndex % N);
-    const int prev = (cur + N - 1) % N;
+void A_Racer::setFinishLine(const sf::FloatRect& rect) {
+    m_finishLine = rect;
+    updateFinishGate();
+}
 
-    const sf::Vector2f A = path[prev];
-    const sf::Vector2f B = path[cur];
+void A_Racer::updateFinishGate() {
+    // La lnea pasa por el punto del carril ms cercano al centro de la meta (si est dentro de
+    // ella) y es perpendicular al carril ah; sin ruta, cruza el rectngulo a lo largo. Solo
+    // cuenta el tramo de la lnea que queda dentro del rectngulo
+    const sf::Vector2f half = m_finishLine.size * 0.5f;
+    const sf::Vector2f center = m_finishLine.position + half;
+    m_gateOrigin = center;
+    m_gateForward = m_finishLine.size.x <= m_finishLine.size.y ? sf::Vector2f{ 1.f, 0.f } : sf::Vector2f{ 0.f, 1.f };
+    m_gateDebt = 0;
+
+    auto xf = getComponentPtr<Transform>();
+    m_lapPrevPos = xf ? xf->getPosition() : sf::Vector2f{};
+    if (m_track->size() < 2) return;
+
+    const float total = m_track->totalLength();
+    const float d = m_track->distanceAlong(center);
+    const sf::Vector2f onLane = m_track->pointAt(d);
+    if (m_finishLine.contains(onLane)) m_gateOrigin = onLane;
+
+    // Tangente promediada sobre el ancho de la meta (estable aunque la meta caiga en un vrtice)
+    const float w = std::min(std::sqrt(half.x * half.x + half.y * half.y), total * 0.25f);
+    const sf::Vector2f t = m_track->pointAt(m_track->wrap(d + w)) - m_track->pointAt(m_track->wrap(d - w));
+    const float len = std::sqrt(t.x * t.x + t.y * t.y);
+    if (len > 1e-4f) m_gateForward = t / len;
+
+    // Parrilla justo detrs de la lnea (a menos de media vuelta): el primer cruce es la salida
+    const float ahead = m_track->wrap(d - m_trackDistance);
+    if (ahead > 0.f && ahead < total * 0.5f) m_gateDebt = 1;
+}
 
-    const float segLen = std::max(1e-4f, vlen(B - A));
-    const float t = 1.f - clamp01(vlen(B - pos) / segLen); // 0 en A, 1 en B
+void A_Racer::updateLap() {
+    auto xf = getComponentPtr<Transform>();
+    if (!xf) return;
+    const sf::Vector2f from = m_lapPrevPos;
+    const sf::Vector2f to = xf->getPosition();
+    m_lapPrevPos = to;
+
+    // Lado de cada extremo respecto a la lnea (>= 0: delante). Solo cuenta cambiar de lado
+    const sf::Vector2f a = from - m_gateOrigin, b = to - m_gateOrigin;
+    const float sideA = a.x * m_gateForward.x + a.y * m_gateForward.y;
+    const float sideB = b.x * m_gateForward.x + b.y * m_gateForward.y;
+    const bool forward = sideA < 0.f && sideB >= 0.f;
+    const bool backward = sideA >= 0.f && sideB < 0.f;
+    if (!forward && !backward) return;
+
+    // Punto de corte del segmento recorrido con la lnea; tiene que caer dentro de la meta
+    // (si no, es otro tramo de la pista que pasa cerca)
+    const float t = sideA / (sideA - sideB);
+    if (!m_finishLine.contains(from + (to - from) * t)) return;
+
+    if (backward) ++m_gateDebt;
+    else if (m_gateDebt > 0) --m_gateDebt;
+    else {
+        ++m_currentLap;
+        m_lapCrossFraction = t;
+    }
+}
 
-    return clamp01((prev + t) / float(N));
+void A_Racer::applySteering(const sf::Vector2f& pos, float rotationDeg, int waypoint, bool moved) {
+    currentWaypointIndex = waypoint;
+    if (!moved) return;
+    if (auto xf = getComponentPtr<Transform>()) {
+        xf->setRotation(rotationDeg);
+        xf->setPosition(pos);
+    }
+    updateTrackDistance();
 }
 
 void A_Racer::update(float deltaTime) {
-    if (!isFinished() && path.size() >= 2) {
+    if (isSteering()) {
         doPathFollowing(deltaTime);
-
-        bool inside = m_finishLine.contains(getComponent<Transform>()->getPosition());
-        if (inside && !m_crossedLastFrame) ++m_currentLap;
-        m_crossedLastFrame = inside;
+        updateTrackDistance();
+        updateLap();
     }
-
-    // <-- clave: copiar Transform -> sprite cada frame
-    Actor::update(deltaTime);
+    // La copia Transform -> sprite la hace TransformStore::syncDrawables() en lote
 }
 
 void A_Racer::doPathFollowing(float dt) {
-    auto xf = getComponent<Transform>();
+    auto xf = getComponentPtr<Transform>();
+    const auto& path = m_track->points();
     if (!xf || path.size() < 2) return;
 
+    // El paso es el mismo que aplica SteeringBatch a todos los corredores en lote
     sf::Vector2f pos = xf->getPosition();
-
-    // Segmento actual A->B
-    const int N = (int)path.size();
-    int i = currentWaypointIndex;
-    sf::Vector2f A = path[i];
-    sf::Vector2f B = path[(i + 1) % N];
-    sf::Vector2f AB = B - A;
-    float abLen2 = AB.x * AB.x + AB.y * AB.y;
-    if (abLen2 < 1e-6f) { currentWaypointIndex = (i + 1) % N; return; }
-    float abLen = std::sqrt(abLen2);
-
-    // Proyeccin del coche sobre el segmento A->B
-    sf::Vector2f AP = pos - A;
-    float t = (AP.x * AB.x + AP.y * AB.y) / abLen2; // 0..1 si ests dentro del segmento
-
-    // Regla de avance de waypoint:
-    // - Si ya pasaste B (t > 1), o
-    // - Si ests suficientemente cerca de B,
-    //   avanza al siguiente
-    float distToB = std::hypot(pos.x - B.x, pos.y - B.y);
-    if (t > 1.f || distToB < arriveRadius) {
-        currentWaypointIndex = (i + 1) % N;
-        i = currentWaypointIndex;
-        A = path[i];
-        B = path[(i + 1) % N];
-        AB = B - A;
-        abLen2 = AB.x * AB.x + AB.y * AB.y;
-        abLen = std::sqrt(abLen2);
-        if (abLen2 < 1e-6f) return;
-        AP = pos - A;
-        t = (AP.x * AB.x + AP.y * AB.y) / abLen2;
-    }
-
-    // Punto de persecucin (pure pursuit) a partir de la proyeccin + lookahead
-    float s = std::clamp(t + (lookaheadDistance / std::max(abLen, 1e-3f)), 0.f, 1.f);
-    sf::Vector2f pursue = A + AB * s;
-
-    // Velocidad con frenado suave al aproximarse al punto de persecucin
-    sf::Vector2f to = pursue - pos;
-    float d = std::hypot(to.x, to.y);
-    if (d > 1e-4f) {
-        sf::Vector2f dir = { to.x / d, to.y / d };
-
-        float brakeRadius = lookaheadDistance * 1.2f;
-        float speed = (d < brakeRadius) ? (m_maxSpeed * (d / brakeRadius)) : m_maxSpeed;
-
-        pos += dir * speed * dt;
-
-        float angleDeg = std::atan2(dir.y, dir.x) * 180.f / 3.14159265f;
-        xf->setRotation(angleDeg);
+    float rotation = xf->getRotation();
+    if (SteeringBatch::steerOne(path.data(), (int)path.size(), currentWaypointIndex,
+            pos, rotation, getSteeringParams(), dt)) {
+        xf->setRotation(rotation);
         xf->setPosition(pos);
     }
-}
\ No newline at end of file
+}
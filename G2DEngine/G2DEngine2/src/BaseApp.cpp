@@ -5,79 +5,17 @@
 #include "A_Racer.h"
 #include "ECS/Transform.h"
 #include "CShape.h"
+#include "SpriteBatch.h"
+#include "DebugGeometry.h"
+#include "StaticLayer.h"
 #include <SFML/Graphics.hpp>
 #include <cmath>
-#include <iostream>
 #include <algorithm>   // std::max
 #include <fstream>     // save/load path
 
-namespace { // ------- helpers de geometría / path -------
+namespace { // ------- helpers de geometría / debug -------
 
     inline float vlen(const sf::Vector2f& v) { return std::sqrt(v.x * v.x + v.y * v.y); }
-    inline sf::Vector2f vnorm(const sf::Vector2f& v) {
-        float L = vlen(v); return (L > 1e-6f) ? sf::Vector2f{ v.x / L, v.y / L } : sf::Vector2f{ 0.f,0.f };
-    }
-    inline sf::Vector2f vperp(const sf::Vector2f& v) { return sf::Vector2f{ -v.y, v.x }; }
-
-    // Densifica una polilínea cerrada para que los segmentos no superen maxSegLen px
-    std::vector<sf::Vector2f> densifyClosed(const std::vector<sf::Vector2f>& pts, float maxSegLen) {
-        std::vector<sf::Vector2f> out;
-        if (pts.size() < 2) return out;
-        const int N = (int)pts.size();
-        out.reserve(N * 4);
-        for (int i = 0; i < N; ++i) {
-            const sf::Vector2f A = pts[i];
-            const sf::Vector2f B = pts[(i + 1) % N];
-            out.push_back(A);
-            const float d = vlen(B - A);
-            if (d > maxSegLen) {
-                int steps = std::max(1, (int)std::floor(d / maxSegLen));
-                sf::Vector2f dir = (B - A) * (1.f / (float)(steps + 1));
-                for (int k = 1; k <= steps; ++k) out.push_back(A + dir * (float)k);
-            }
-        }
-        return out;
-    }
-
-    // Offset lateral de una polilínea cerrada usando bisectriz (más suave en curvas)
-    std::vector<sf::Vector2f> offsetClosed(const std::vector<sf::Vector2f>& path, float offsetPx) {
-        const int N = (int)path.size();
-        if (N < 2 || std::abs(offsetPx) < 1e-6f) return path;
-        std::vector<sf::Vector2f> res(N);
-        for (int i = 0; i < N; ++i) {
-            const sf::Vector2f Pm = path[(i - 1 + N) % N];
-            const sf::Vector2f P = path[i];
-            const sf::Vector2f Pp = path[(i + 1) % N];
-
-            sf::Vector2f t1 = vnorm(P - Pm);
-            sf::Vector2f t2 = vnorm(Pp - P);
-            sf::Vector2f t = vnorm(t1 + t2);
-            if (t.x == 0.f && t.y == 0.f) t = t1;
-
-            sf::Vector2f nrm = vnorm(vperp(t));   // normal a la izquierda
-            res[i] = P + nrm * offsetPx;
-        }
-        return res;
-    }
-
-    // Debug: dibuja una polilínea cerrada con puntos
-    void drawClosedPath(Window& w, const std::vector<sf::Vector2f>& p, sf::Color col) {
-        if (p.size() < 2) return;
-
-        sf::VertexArray va(sf::PrimitiveType::LineStrip);
-        va.resize(p.size() + 1);
-        for (std::size_t i = 0; i < p.size(); ++i) {
-            va[i].position = p[i];
-            va[i].color = col;
-        }
-        va[p.size()].position = p[0];
-        va[p.size()].color = col;
-
-        w.draw(va);
-
-        sf::CircleShape c(3.f); c.setFillColor(col);
-        for (auto& pt : p) { c.setPosition(pt - sf::Vector2f{ 3.f,3.f }); w.draw(c); }
-    }
 
 } // namespace
 
@@ -109,154 +47,192 @@ int BaseApp::run()
         return -1;
     }
 
-    float raceTimer = 0.f;
-
-    // ⚙ Lambda para finalizar el trazado (sin usar sf::Event por defecto)
-    auto finalizePath = [&]() {
-        if (!s_editMode || s_editPts.size() < 3) return;
+    while (m_windowPtr->isOpen()) {
+        runFrame();
+    }
 
-        // Cerrar el lazo si falta
-        if (vlen(s_editPts.front() - s_editPts.back()) > 5.f)
-            s_editPts.push_back(s_editPts.front());
+    destroy();
+    return 0;
+}
 
-        // Densificar y aplicar carriles
-        m_path = densifyClosed(s_editPts, 30.f);
+// Finaliza el trazado en edición (sin usar sf::Event por defecto)
+void BaseApp::finalizePath()
+{
+    if (!s_editMode || s_editPts.size() < 3) return;
 
-        std::vector<std::vector<sf::Vector2f>> lanes;
-        lanes.push_back(m_path);
-        lanes.push_back(offsetClosed(m_path, +12.f));
-        lanes.push_back(offsetClosed(m_path, -12.f));
-        lanes.push_back(offsetClosed(m_path, +24.f));
+    // Cerrar el lazo si falta
+    if (vlen(s_editPts.front() - s_editPts.back()) > 5.f)
+        s_editPts.push_back(s_editPts.front());
 
-        for (std::size_t i = 0; i < m_racers.size(); ++i) {
-            auto lane = lanes[std::min<std::size_t>(i, lanes.size() - 1)];
-            m_racers[i]->setPath(lane);
-            if (auto xf = m_racers[i]->getComponent<Transform>())
-                xf->setPosition(lane.front());
-        }
-        };
+    // Densificar y aplicar carriles
+    m_race.setPath(RaceWorld::densifyClosed(s_editPts, 30.f), { 0.f, +12.f, -12.f, +24.f });
+    TransformStore::instance().snapshot(); // los corredores saltan a la nueva salida sin interpolar
+}
 
-    while (m_windowPtr->isOpen()) {
-        // ── Eventos ─────────────────────────────────────────────────────────────
-        m_windowPtr->handleEvents([&](const sf::Event& e) {
-            gui.processEvent(m_windowPtr, e);
+void BaseApp::runFrame()
+{
+    // Etiqueta la fase actual para atribuir asignaciones (ver FrameAllocCheck)
+    EngineUtilities::AllocationScope allocTag("Window::handleEvents");
 
-            if (e.is<sf::Event::Closed>()) {
-                m_windowPtr->close();
-            }
-            if (e.is<sf::Event::KeyPressed>()) {
-                auto kp = e.getIf<sf::Event::KeyPressed>();
-                if (!kp) return;
-                if (kp->scancode == sf::Keyboard::Scancode::Escape) m_windowPtr->close();
-                if (kp->scancode == sf::Keyboard::Scancode::E)      s_editMode = !s_editMode;
-                if (s_editMode && kp->scancode == sf::Keyboard::Scancode::Z && !s_editPts.empty())
-                    s_editPts.pop_back();
-                if (s_editMode && kp->scancode == sf::Keyboard::Scancode::C)
-                    s_editPts.clear();
-                if (s_editMode && kp->scancode == sf::Keyboard::Scancode::F)
-                    finalizePath(); // ✅ sin sf::Event falso
-            }
-            if (e.is<sf::Event::MouseButtonPressed>()) {
-                if (!s_editMode) return;
-                auto mb = e.getIf<sf::Event::MouseButtonPressed>();
-                if (!mb || mb->button != sf::Mouse::Button::Left) return;
+    // ── Eventos ─────────────────────────────────────────────────────────────
+    m_windowPtr->handleEvents([&](const sf::Event& e) {
+        gui.processEvent(m_windowPtr, e);
 
-                // Mapeo pixel->coords (usa la view actual)
-                auto& rw = m_windowPtr->getInternal();
-                sf::Vector2i pix = sf::Mouse::getPosition(rw);
-                sf::Vector2f world = rw.mapPixelToCoords(pix);
+        if (e.is<sf::Event::Closed>()) {
+            m_windowPtr->close();
+        }
+        if (e.is<sf::Event::KeyPressed>()) {
+            auto kp = e.getIf<sf::Event::KeyPressed>();
+            if (!kp) return;
+            if (kp->scancode == sf::Keyboard::Scancode::Escape) m_windowPtr->close();
+            if (kp->scancode == sf::Keyboard::Scancode::E)      s_editMode = !s_editMode;
+            if (s_editMode && kp->scancode == sf::Keyboard::Scancode::Z && !s_editPts.empty())
+                s_editPts.pop_back();
+            if (s_editMode && kp->scancode == sf::Keyboard::Scancode::C)
+                s_editPts.clear();
+            if (s_editMode && kp->scancode == sf::Keyboard::Scancode::F)
+                finalizePath(); // ✅ sin sf::Event falso
+        }
+        if (e.is<sf::Event::MouseButtonPressed>()) {
+            if (!s_editMode) return;
+            auto mb = e.getIf<sf::Event::MouseButtonPressed>();
+            if (!mb || mb->button != sf::Mouse::Button::Left) return;
 
-                s_editPts.push_back(world);
-            }
-            });
+            // Mapeo pixel->coords (usa la view actual)
+            auto& rw = m_windowPtr->getInternal();
+            sf::Vector2i pix = sf::Mouse::getPosition(rw);
+            sf::Vector2f world = rw.mapPixelToCoords(pix);
 
-        // ── Tiempo ──────────────────────────────────────────────────────────────
-        m_windowPtr->update();
-        float dt = m_windowPtr->deltaTime.asSeconds();
-        if (!gui.isPaused())
-            raceTimer += dt * gui.getSpeedMultiplier();
+            s_editPts.push_back(world);
+        }
+        });
+
+    // ── Tiempo ──────────────────────────────────────────────────────────────
+    allocTag.set("Window::update");
+    m_windowPtr->update();
+    float dt = m_windowPtr->deltaTime.asSeconds();
+
+    // ── Lógica de carrera (paso fijo) ───────────────────────────────────────
+    // La simulación avanza en pasos de 1/Hz sin importar el frame rate ni el multiplicador
+    // de velocidad; el render interpola entre los dos últimos pasos.
+    allocTag.set("BaseApp::raceLogic");
+    auto& transforms = TransformStore::instance();
+    m_timestep.setRate(float(gui.getSimulationHz()));
+    m_timestep.setMaxSubsteps(gui.getMaxSubsteps());
+    if (!gui.isPaused()) {
+        const int steps = m_timestep.advance(dt * gui.getSpeedMultiplier());
+        for (int s = 0; s < steps; ++s) {
+            if (s == steps - 1) transforms.snapshot(); // estado anterior para interpolar
+            m_race.step(m_timestep.getStep());
+        }
+    }
 
-        // ── Lógica de carrera ───────────────────────────────────────────────────
-        for (auto& r : m_racers) {
-            if (!r) continue;
+    // Reset pedido por GUI (sin interpolar el salto a la salida)
+    if (gui.shouldResetWaypoints()) {
+        m_race.reset();
+        m_timestep.reset();
+        transforms.snapshot();
+    }
 
-            if (!gui.isPaused())
-                r->update(dt * gui.getSpeedMultiplier());
+    // ── GUI ─────────────────────────────────────────────────────────────────
+    allocTag.set("EngineGUI::update");
+    gui.setRacers(m_race.getStandings());
+    gui.update(m_windowPtr, m_windowPtr->deltaTime, m_race.getRaceTime());
+    if (gui.shouldQuit()) m_windowPtr->close();
 
-            if (r->getPlace() == 0 && r->isFinished()) {
-                int p = int(m_finishedOrder.size()) + 1;
-                r->setPlace(p);
-                m_finishedOrder.push_back(r);
-            }
+    // Ventana chiquita de Path Tools
+    allocTag.set("BaseApp::pathTools");
+    {
+        ImGui::Begin("Path Tools", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
+        ImGui::Text("Edit mode: %s  (press 'E' to toggle)", s_editMode ? "ON" : "OFF");
+        ImGui::Text("Points: %d", (int)s_editPts.size());
+        if (ImGui::Button("Finalize (F)")) {
+            finalizePath(); // ✅ llamar directo
         }
-
-        // Reset pedido por GUI
-        if (gui.shouldResetWaypoints()) {
-            for (auto& r : m_racers) if (r) r->reset();
-            m_finishedOrder.clear();
-            raceTimer = 0.f;
+        if (ImGui::Button("Save path")) {
+            savePathTxt("bin/Paths/track.path", s_editPts);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Load path")) {
+            std::vector<sf::Vector2f> tmp;
+            if (loadPathTxt("bin/Paths/track.path", tmp)) s_editPts = tmp;
         }
+        ImGui::Separator();
+        ImGui::Text("Click izq: add point | Z: undo | C: clear | F: finish");
+        const auto& sync = transforms.lastSyncStats();
+        ImGui::Text("Transform sync: %zu | skipped: %zu", sync.synced, sync.skipped);
+        const auto& batch = m_spriteBatch.getStats();
+        const RenderStats& stats = m_windowPtr->getRenderStats();
+        ImGui::Text("Draw calls: %zu | commands: %zu | vertices: %zu | texture switches: %zu",
+            stats.drawCalls, stats.commands, stats.vertices, stats.textureSwitches);
+        ImGui::Text("Sprites: %zu in %zu batch(es)", batch.sprites, batch.batches);
+        ImGui::Text("Static layer bakes: %zu%s", m_staticLayer.getBakeCount(),
+            m_staticLayer.isCached() ? "" : " (no RenderTexture, drawn directly)");
+        ImGui::End();
+    }
 
-        // ── GUI ─────────────────────────────────────────────────────────────────
-        gui.setRacers(m_racers);
-        gui.update(m_windowPtr, m_windowPtr->deltaTime, raceTimer);
-        if (gui.shouldQuit()) m_windowPtr->close();
+    // Transform -> shapes/sprites de todos los actores modificados, en un solo bucle
+    allocTag.set("TransformStore::syncDrawables");
+    transforms.syncDrawables(gui.isInterpolationEnabled() ? m_timestep.alpha() : 1.f);
 
-        // Ventana chiquita de Path Tools
-        {
-            ImGui::Begin("Path Tools", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
-            ImGui::Text("Edit mode: %s  (press 'E' to toggle)", s_editMode ? "ON" : "OFF");
-            ImGui::Text("Points: %d", (int)s_editPts.size());
-            if (ImGui::Button("Finalize (F)")) {
-                finalizePath(); // ✅ llamar directo
-            }
-            if (ImGui::Button("Save path")) {
-                savePathTxt("bin/Paths/track.path", s_editPts);
-            }
-            ImGui::SameLine();
-            if (ImGui::Button("Load path")) {
-                std::vector<sf::Vector2f> tmp;
-                if (loadPathTxt("bin/Paths/track.path", tmp)) s_editPts = tmp;
-            }
-            ImGui::Separator();
-            ImGui::Text("Click izq: add point | Z: undo | C: clear | F: finish");
-            ImGui::End();
-        }
+    // ── Render ──────────────────────────────────────────────────────────────
+    // Cada parte encola sus draws con capa y profundidad; Window::flush() los ordena (capa ->
+    // profundidad -> orden de envío) y los dibuja
+    allocTag.set("Render::track");
+    m_windowPtr->clear(sf::Color::Black);
 
-        // ── Render ──────────────────────────────────────────────────────────────
-        m_windowPtr->clear(sf::Color::Black);
+    // Ruta activa (cian) y ruta en edición (magenta): solo se regeneran si cambian los puntos
+    if (m_race.getPath().size() >= 2) m_pathGeometry.setClosedPath(m_race.getPath(), sf::Color(0, 255, 255));
+    else m_pathGeometry.clear();
 
+    // Pista + ruta activa: horneadas en la capa estática (un draw) o encoladas cada frame
+    if (gui.isStaticLayerEnabled()) {
+        m_staticLayer.submit(m_renderQueue, *m_windowPtr, RenderLayer::Background);
+    }
+    else {
         if (!m_trackActor.isNull())
-            m_trackActor->render(m_windowPtr);
+            m_trackActor->submit(m_renderQueue);
+        m_pathGeometry.submit(m_renderQueue, RenderLayer::Debug, 0.f);
+    }
 
-        // Ruta activa (cian)
-        if (m_path.size() >= 2) drawClosedPath(*m_windowPtr, m_path, sf::Color(0, 255, 255));
-        // Ruta en edición (magenta)
-        if (!s_editPts.empty()) drawClosedPath(*m_windowPtr, s_editPts, sf::Color(255, 0, 255));
+    allocTag.set("Render::debugPaths");
+    if (!s_editPts.empty()) m_editGeometry.setClosedPath(s_editPts, sf::Color(255, 0, 255));
+    else m_editGeometry.clear();
+    m_editGeometry.submit(m_renderQueue, RenderLayer::Debug, 1.f);
 
-        // Puntitos amarillos (posición real)
-        {
-            sf::CircleShape dot(5.f);
-            dot.setFillColor(sf::Color::Yellow);
-            for (auto& r : m_racers) {
-                if (!r) continue;
-                if (auto xf = r->getComponent<Transform>()) {
-                    dot.setPosition(xf->getPosition());
-                    m_windowPtr->draw(dot);
-                }
-            }
+    // Puntitos amarillos (posición real), todos en un draw; con la carrera parada no se regeneran
+    allocTag.set("Render::racerDots");
+    m_racerDotCenters.clear();
+    for (auto& r : m_race.getRacers()) {
+        if (!r) continue;
+        if (auto xf = r->getComponentPtr<Transform>()) {
+            m_racerDotCenters.push_back(xf->getPosition() + sf::Vector2f{ 5.f, 5.f });
         }
-
-        // Sprites de los racers
-        for (auto& r : m_racers)
-            if (r) r->render(m_windowPtr);
-
-        gui.render(m_windowPtr);
-        m_windowPtr->display();
+    }
+    m_racerDots.setDiscs(m_racerDotCenters, sf::Color::Yellow, 5.f);
+    m_racerDots.submit(m_renderQueue, RenderLayer::Debug, 2.f);
+
+    // Sprites de los racers: un comando por textura (o uno por sprite, en orden de envío)
+    allocTag.set("Render::racers");
+    if (gui.isSpriteBatchingEnabled()) {
+        const sf::View& view = m_windowPtr->getInternal().getView();
+        m_spriteBatch.begin({ view.getCenter() - view.getSize() * 0.5f, view.getSize() });
+        for (auto& r : m_race.getRacers())
+            if (r) r->renderBatched(m_spriteBatch);
+        m_spriteBatch.submit(m_renderQueue, RenderLayer::Sprites);
+    }
+    else {
+        for (auto& r : m_race.getRacers())
+            if (r) r->submit(m_renderQueue);
     }
 
-    destroy();
-    return 0;
+    allocTag.set("Render::flush");
+    m_windowPtr->flush(m_renderQueue);
+
+    allocTag.set("EngineGUI::render");
+    gui.render(m_windowPtr);
+    allocTag.set("Window::display");
+    m_windowPtr->display();
 }
 
 bool BaseApp::init()
@@ -282,6 +258,9 @@ bool BaseApp::init()
     }
 
     m_trackActor = EngineUtilities::MakeShared<Actor>("Track");
+    m_trackActor->setRenderLayer(RenderLayer::Background);
+    m_trackActor->setTextureFillsShape(true);
+    sf::Vector2f trackScale{ 1.f, 1.f };
     {
         auto sh = m_trackActor->getComponent<CShape>();
         if (!sh) {
@@ -296,48 +275,27 @@ bool BaseApp::init()
             r->setSize({ float(sz.x), float(sz.y) });
             r->setOrigin({ 0.f, 0.f });
         }
-        float sx = 1920.f / float(sz.x);
-        float sy = 1080.f / float(sz.y);
-        sh->setScale({ sx, sy });
+        trackScale = { 1920.f / float(sz.x), 1080.f / float(sz.y) };
     }
     m_trackActor->setTexture(trackTex);
-    m_trackActor->getComponent<Transform>()->setPosition({ 0.f, 0.f });
-
-    // 4) Ruta inicial mínima (puedes borrarla y dibujar la tuya)
-    m_path = {
-        {100.f,150.f}, {300.f,140.f}, {500.f,160.f}, {700.f,300.f},
-        {900.f,280.f}, {1100.f,500.f}, {1300.f,480.f}, {1500.f,450.f}
-    };
-    m_path = densifyClosed(m_path, 30.f);
-
-    // 5) Corredores (Mario, Luigi, Peach, Yoshi)
-    auto r1 = EngineUtilities::MakeShared<A_Racer>("YOSHI", 1);
-    auto r2 = EngineUtilities::MakeShared<A_Racer>("MARIO", 2);
-    auto r3 = EngineUtilities::MakeShared<A_Racer>("SONIC", 3);
-    auto r4 = EngineUtilities::MakeShared<A_Racer>("RAYO", 4);
-
-    // Carriles por offset (valores moderados; ajusta según ancho de pista)
-    auto base = m_path;
-    auto laneA = offsetClosed(base, +8.f);
-    auto laneB = offsetClosed(base, -8.f);
-    auto laneC = offsetClosed(base, +16.f);
-
-    r1->setPath(base);
-    r2->setPath(laneA);
-    r3->setPath(laneB);
-    r4->setPath(laneC);
-
-    // Grid de salida
-    r1->getComponent<Transform>()->setPosition(base.front() + sf::Vector2f{ 0.f,  0.f });
-    r2->getComponent<Transform>()->setPosition(laneA.front() + sf::Vector2f{ 0.f, 16.f });
-    r3->getComponent<Transform>()->setPosition(laneB.front() + sf::Vector2f{ 16.f,  0.f });
-    r4->getComponent<Transform>()->setPosition(laneC.front() + sf::Vector2f{ 16.f, 16.f });
-
-    // Texturas de personajes
-    resourceMan.loadTexture("Sprites/YOSHI", "png");
-    resourceMan.loadTexture("Sprites/MARIO", "png");
-    resourceMan.loadTexture("Sprites/SONIC", "png");
-    resourceMan.loadTexture("Sprites/RAYO", "png");
+    // La CShape está ligada al Transform: la escala de ajuste va en el Transform o syncDrawables la pisa
+    auto trackXf = m_trackActor->getComponent<Transform>();
+    trackXf->setPosition({ 0.f, 0.f });
+    trackXf->setScale(trackScale);
+    m_staticLayer.addActor(m_trackActor);
+    m_staticLayer.addGeometry(m_pathGeometry);
+
+    // 4) Ruta, corredores y parrilla de salida (la misma carrera que corre el modo headless)
+    m_race.buildDefault(3);
+    const auto& racers = m_race.getRacers();
+    const auto& r1 = racers[0];
+    const auto& r2 = racers[1];
+    const auto& r3 = racers[2];
+    const auto& r4 = racers[3];
+
+    // 5) Texturas de personajes: una sola página de atlas para los cuatro (un draw con SpriteBatch)
+    if (!resourceMan.loadAtlas({ "Sprites/YOSHI", "Sprites/MARIO", "Sprites/SONIC", "Sprites/RAYO" }, "png"))
+        MESSAGE("BaseApp", "init", "Cannot load racer sprites");
 
     auto texYOSHI = resourceMan.getTexture("Sprites/YOSHI");
     auto texMARIO = resourceMan.getTexture("Sprites/MARIO");
@@ -349,17 +307,8 @@ bool BaseApp::init()
     if (!texSONIC.isNull()) r3->setTexture(texSONIC);
     if (!texRAYO.isNull()) r4->setTexture(texRAYO);
 
-    m_racers = { r1, r2, r3, r4 };
-
     // 6) Línea de meta (posición + tamaño)
-    m_finishLine = sf::FloatRect{ {1800.f,500.f}, {50.f,200.f} };
-
-    // Meta + laps
-    for (auto& r : m_racers) {
-        if (!r) continue;
-        r->setFinishLine(m_finishLine);
-        r->setTotalLaps(3);
-    }
+    m_race.setFinishLine(sf::FloatRect{ {1800.f,500.f}, {50.f,200.f} });
 
     // Auto-escala de sprites a tamaño "kart"
     auto fitSprite = [&](const EngineUtilities::TSharedPointer<A_Racer>& racer,
@@ -367,7 +316,7 @@ bool BaseApp::init()
         float targetPx)
         {
             if (texComp.isNull()) return;
-            auto texSize = texComp->getTexture().getSize(); // Vector2u
+            auto texSize = texComp->getSize(); // Vector2u (zona del sprite, no la página del atlas)
             float w = static_cast<float>(texSize.x);
             float h = static_cast<float>(texSize.y);
             float s = targetPx / std::max(w, h);            // escala uniforme
@@ -382,7 +331,7 @@ bool BaseApp::init()
     fitSprite(r4, texRAYO, 48.f);
 
     // 7) GUI arranque
-    gui.setRacers(m_racers);
+    gui.setRacers(m_race.getRacers());
 
     return true;
 }
\ No newline at end of file
@@ -0,0 +1,242 @@
+#include "BatchRunner.h"
+#include "HeadlessRunner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+    // splitmix64: mismo resultado en cualquier compilador (las distribuciones de <random> no lo garantizan)
+    inline std::uint64_t splitmix64(std::uint64_t& state) {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // Uniforme en [lo, hi) con los 24 bits altos (exactos en float)
+    inline float uniform(std::uint64_t& state, float lo, float hi) {
+        const float u = float(splitmix64(state) >> 40) * (1.f / 16777216.f);
+        return lo + (hi - lo) * u;
+    }
+
+    template<typename T>
+    void writeRaw(std::FILE* f, const T& value) {
+        std::fwrite(&value, sizeof(T), 1, f);
+    }
+
+} // namespace
+
+BatchRunner::Options BatchRunner::parseOptions(int argc, char** argv) {
+    Options o;
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--races") && i + 1 < argc) o.races = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--laps") && i + 1 < argc) o.laps = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--threads") && i + 1 < argc) o.threads = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--seed") && i + 1 < argc) o.seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--dt") && i + 1 < argc) o.dt = float(std::atof(argv[++i]));
+        else if (!std::strcmp(argv[i], "--max-time") && i + 1 < argc) o.maxRaceTime = float(std::atof(argv[++i]));
+        else if (!std::strcmp(argv[i], "--out") && i + 1 < argc) o.output = argv[++i];
+        else if (!std::strcmp(argv[i], "--format") && i + 1 < argc) {
+            o.format = !std::strcmp(argv[++i], "bin") ? Format::Binary : Format::Csv;
+        }
+        else if (!std::strcmp(argv[i], "--steering") && i + 1 < argc) {
+            o.steering = !std::strcmp(argv[++i], "per-racer")
+                ? RaceWorld::SteeringMode::PerRacer : RaceWorld::SteeringMode::Batched;
+        }
+    }
+    if (o.races < 0) o.races = 0;
+    if (o.laps < 1) o.laps = 1;
+    if (o.threads < 0) o.threads = 0;
+    if (!(o.dt > 0.f)) o.dt = 1.f / 60.f;
+    if (!(o.maxRaceTime > 0.f)) o.maxRaceTime = 600.f;
+    return o;
+}
+
+bool BatchRunner::isRequested(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--batch")) return true;
+    }
+    return false;
+}
+
+std::uint64_t BatchRunner::raceSeed(std::uint64_t baseSeed, int race) {
+    std::uint64_t state = baseSeed ^ (std::uint64_t(race) * 0xD1B54A32D192ED03ull);
+    return splitmix64(state);
+}
+
+int BatchRunner::resolveThreadCount() const {
+    int threads = m_options.threads;
+    if (threads <= 0) threads = int(std::thread::hardware_concurrency());
+    if (threads <= 0) threads = 1;
+    return std::min(threads, std::max(m_options.races, 1));
+}
+
+BatchRunner::RaceResult BatchRunner::runRace(std::uint64_t seed) const {
+    RaceWorld world;
+    world.buildDefault(m_options.laps);
+    world.setSteeringMode(m_options.steering);
+
+    // Parámetros aleatorios de cada corredor, en orden fijo para que solo dependan de seed
+    std::uint64_t rng = seed;
+    const auto& racers = world.getRacers();
+    std::vector<float> lanes(racers.size(), 0.f);
+    for (std::size_t i = 0; i < racers.size(); ++i) {
+        racers[i]->setMaxSpeed(uniform(rng, m_options.minSpeed, m_options.maxSpeed));
+        racers[i]->setLookahead(uniform(rng, m_options.minLookahead, m_options.maxLookahead));
+        lanes[i] = uniform(rng, -m_options.maxLaneOffset, m_options.maxLaneOffset);
+    }
+    const std::vector<sf::Vector2f> path = world.getPath();
+    world.setPath(path, lanes);
+    world.setFinishLine(HeadlessRunner::finishLineAtStart(path, 64.f, 320.f));
+
+    while (!world.isFinished() && world.getRaceTime() < m_options.maxRaceTime) {
+        world.step(m_options.dt);
+    }
+
+    RaceResult result;
+    result.seed = seed;
+    result.finished = world.isFinished();
+    result.racers.resize(racers.size());
+    for (std::size_t i = 0; i < racers.size(); ++i) {
+        const A_Racer& r = *racers[i];
+        RacerResult& out = result.racers[i];
+        out.name = r.getName();
+        out.maxSpeed = r.getMaxSpeed();
+        out.lookahead = r.getLookahead();
+        out.laneOffset = lanes[i];
+        out.place = r.getPlace();
+        if (out.place > 0) out.finishTime = world.getFinishTimes()[std::size_t(out.place - 1)];
+
+        // Tiempos acumulados -> duración de cada vuelta
+        float previous = 0.f;
+        for (float t : world.getLapTimes(i)) {
+            out.lapTimes.push_back(t - previous);
+            previous = t;
+        }
+    }
+    return result;
+}
+
+int BatchRunner::run() {
+    const int races = m_options.races;
+    const int threads = resolveThreadCount();
+    std::printf("Batch: %d races, %d laps, %d thread(s), seed %llu, dt=%.4f s\n",
+        races, m_options.laps, threads, static_cast<unsigned long long>(m_options.seed), m_options.dt);
+
+    m_results.assign(std::size_t(races), {});
+    std::atomic<int> nextRace{ 0 };
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    // Pool mínimo: cada hilo toma la siguiente carrera libre hasta acabar con todas. Cada
+    // resultado va a su casilla, así que el orden de escritura no depende del reparto
+    auto worker = [&]() {
+        for (;;) {
+            const int race = nextRace.fetch_add(1);
+            if (race >= races) return;
+            try {
+                m_results[std::size_t(race)] = runRace(raceSeed(m_options.seed, race));
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error) error = std::current_exception();
+                nextRace.store(races);
+                return;
+            }
+        }
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    pool.reserve(std::size_t(threads - 1));
+    for (int t = 1; t < threads; ++t) pool.emplace_back(worker);
+    worker();
+    for (auto& thread : pool) thread.join();
+    if (error) std::rethrow_exception(error);
+
+    const double wallSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const int timedOut = int(std::count_if(m_results.begin(), m_results.end(),
+        [](const RaceResult& r) { return !r.finished; }));
+    std::printf("Simulated %d races in %.3f s: %.1f races/s\n",
+        races, wallSec, races / (wallSec > 0.0 ? wallSec : 1e-9));
+
+    const bool written = m_options.format == Format::Binary
+        ? writeBinary(m_options.output) : writeCsv(m_options.output);
+    if (!written) {
+        std::fprintf(stderr, "Could not write %s\n", m_options.output.c_str());
+        return 2;
+    }
+    std::printf("Results written to %s\n", m_options.output.c_str());
+
+    if (timedOut > 0) {
+        std::printf("%d race(s) hit --max-time %.0f s before every racer finished\n",
+            timedOut, m_options.maxRaceTime);
+        return 1;
+    }
+    return 0;
+}
+
+bool BatchRunner::writeCsv(const std::string& path) const {
+    std::FILE* f = std::fopen(path.c_str(), "w");
+    if (!f) return false;
+
+    std::fprintf(f, "race,seed,racer,place,finish_time,max_speed,lookahead,lane_offset");
+    for (int lap = 1; lap <= m_options.laps; ++lap) std::fprintf(f, ",lap%d", lap);
+    std::fprintf(f, "\n");
+
+    for (std::size_t race = 0; race < m_results.size(); ++race) {
+        const RaceResult& result = m_results[race];
+        for (const RacerResult& r : result.racers) {
+            std::fprintf(f, "%zu,%llu,%s,%d,", race, static_cast<unsigned long long>(result.seed),
+                r.name.c_str(), r.place);
+            if (r.place > 0) std::fprintf(f, "%.4f", r.finishTime);
+            std::fprintf(f, ",%.3f,%.3f,%.3f", r.maxSpeed, r.lookahead, r.laneOffset);
+            for (int lap = 0; lap < m_options.laps; ++lap) {
+                if (std::size_t(lap) < r.lapTimes.size()) std::fprintf(f, ",%.4f", r.lapTimes[std::size_t(lap)]);
+                else std::fprintf(f, ",");
+            }
+            std::fprintf(f, "\n");
+        }
+    }
+    return std::fclose(f) == 0;
+}
+
+bool BatchRunner::writeBinary(const std::string& path) const {
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) return false;
+
+    const std::uint32_t racersPerRace = m_results.empty() ? 0u : std::uint32_t(m_results.front().racers.size());
+    std::fwrite("G2DB", 1, 4, f);
+    writeRaw(f, std::uint32_t(1));
+    writeRaw(f, std::uint32_t(m_results.size()));
+    writeRaw(f, racersPerRace);
+    writeRaw(f, std::uint32_t(m_options.laps));
+    writeRaw(f, std::uint64_t(m_options.seed));
+
+    for (std::size_t race = 0; race < m_results.size(); ++race) {
+        const RaceResult& result = m_results[race];
+        for (std::size_t i = 0; i < result.racers.size(); ++i) {
+            const RacerResult& r = result.racers[i];
+            writeRaw(f, std::uint32_t(race));
+            writeRaw(f, std::uint32_t(i));
+            writeRaw(f, std::int32_t(r.place));
+            writeRaw(f, r.finishTime);
+            writeRaw(f, r.maxSpeed);
+            writeRaw(f, r.lookahead);
+            writeRaw(f, r.laneOffset);
+            for (int lap = 0; lap < m_options.laps; ++lap) {
+                writeRaw(f, std::size_t(lap) < r.lapTimes.size() ? r.lapTimes[std::size_t(lap)] : -1.f);
+            }
+        }
+    }
+    const bool ok = !std::ferror(f);
+    return std::fclose(f) == 0 && ok;
+}
@@ -1,5 +1,6 @@
 ﻿#include "CShape.h"
 #include "Window.h"
+#include "ECS/TransformStore.h"
 
 // Constructor por defecto: crea un círculo para evitar punteros nulos
 CShape::CShape()
@@ -17,25 +18,31 @@ CShape::CShape(ShapeType shapeType)
     createShape(shapeType);
 }
 
+// Si sigue ligada a un Transform, el almacén no debe quedarse con un puntero colgante
+CShape::~CShape() {
+    if (m_boundStore) m_boundStore->unbindShape(m_boundIndex, this);
+}
+
 // Crea una forma según el tipo indicado
 void CShape::createShape(ShapeType shapeType) {
     m_shapeType = shapeType;
+    markChanged();
 
     switch (shapeType) {
     case ShapeType::CIRCLE: {
-        auto circleSP = EngineUtilities::MakeShared<sf::CircleShape>(10.f);
+        auto circleSP = EngineUtilities::MakePooled<sf::CircleShape>(10.f);
         circleSP->setFillColor(sf::Color::Green);
         m_shapePtr = circleSP;
         break;
     }
     case ShapeType::RECTANGLE: {
-        auto rectSP = EngineUtilities::MakeShared<sf::RectangleShape>(sf::Vector2f(100.f, 50.f));
+        auto rectSP = EngineUtilities::MakePooled<sf::RectangleShape>(sf::Vector2f(100.f, 50.f));
         rectSP->setFillColor(sf::Color::White);
         m_shapePtr = rectSP;
         break;
     }
     case ShapeType::TRIANGLE: {
-        auto convex = EngineUtilities::MakeShared<sf::ConvexShape>(3);
+        auto convex = EngineUtilities::MakePooled<sf::ConvexShape>(3);
         convex->setPoint(0, sf::Vector2f(0.f, 0.f));
         convex->setPoint(1, sf::Vector2f(50.f, 100.f));
         convex->setPoint(2, sf::Vector2f(100.f, 0.f));
@@ -44,7 +51,7 @@ void CShape::createShape(ShapeType shapeType) {
         break;
     }
     case ShapeType::POLYGON: {
-        auto poly = EngineUtilities::MakeShared<sf::ConvexShape>(5);
+        auto poly = EngineUtilities::MakePooled<sf::ConvexShape>(5);
         poly->setPoint(0, sf::Vector2f(0.f, 0.f));
         poly->setPoint(1, sf::Vector2f(50.f, 100.f));
         poly->setPoint(2, sf::Vector2f(100.f, 0.f));
@@ -76,10 +83,24 @@ void CShape::render(const EngineUtilities::TSharedPointer<Window>& window) {
     }
 }
 
-// Cambia posición usando coordenadas x, y
+// Igual que render(), pero sobre cualquier RenderTarget (capas en RenderTexture)
+void CShape::renderTo(sf::RenderTarget& target) const {
+    if (m_shapePtr) target.draw(*m_shapePtr);
+}
+
+// Encola la forma; Window::flush() la dibuja en orden de capa/profundidad/textura
+void CShape::submit(RenderQueue& queue, RenderLayer layer, float depth) const {
+    if (m_shapePtr) queue.submit(layer, depth, *m_shapePtr);
+}
+
+// Cambia posición usando coordenadas x, y (en el Transform si la forma está ligada a uno)
 void CShape::setPosition(float x, float y) {
-    if (m_shapePtr) {
+    if (m_boundStore) {
+        m_boundStore->setPosition(m_boundIndex, sf::Vector2f(x, y));
+    }
+    else if (m_shapePtr) {
         m_shapePtr->setPosition(sf::Vector2f(x, y));
+        markChanged();
     }
     else {
         ERROR("CShape", "setPosition", "Shape is not initialized.");
@@ -88,8 +109,12 @@ void CShape::setPosition(float x, float y) {
 
 // Cambia posición usando vector 2D
 void CShape::setPosition(const sf::Vector2f& position) {
-    if (m_shapePtr) {
+    if (m_boundStore) {
+        m_boundStore->setPosition(m_boundIndex, position);
+    }
+    else if (m_shapePtr) {
         m_shapePtr->setPosition(position);
+        markChanged();
     }
     else {
         ERROR("CShape", "setPosition", "Shape is not initialized.");
@@ -100,6 +125,7 @@ void CShape::setPosition(const sf::Vector2f& position) {
 void CShape::setFillColor(const sf::Color& color) {
     if (m_shapePtr) {
         m_shapePtr->setFillColor(color);
+        markChanged();
     }
     else {
         ERROR("CShape", "setFillColor", "Shape is not initialized.");
@@ -108,8 +134,12 @@ void CShape::setFillColor(const sf::Color& color) {
 
 // Rota la forma en grados
 void CShape::setRotation(float angleDegrees) {
-    if (m_shapePtr) {
+    if (m_boundStore) {
+        m_boundStore->setRotation(m_boundIndex, angleDegrees);
+    }
+    else if (m_shapePtr) {
         m_shapePtr->setRotation(sf::degrees(angleDegrees));
+        markChanged();
     }
     else {
         ERROR("CShape", "setRotation", "Shape is not initialized.");
@@ -118,8 +148,12 @@ void CShape::setRotation(float angleDegrees) {
 
 // Escala la forma
 void CShape::setScale(const sf::Vector2f& scl) {
-    if (m_shapePtr) {
+    if (m_boundStore) {
+        m_boundStore->setScale(m_boundIndex, scl);
+    }
+    else if (m_shapePtr) {
         m_shapePtr->setScale(scl);
+        markChanged();
     }
     else {
         ERROR("CShape", "setScale", "Shape is not initialized.");
@@ -135,5 +169,7 @@ sf::Shape* CShape::getShape() {
 void CShape::setTexture(const EngineUtilities::TSharedPointer<Texture>& texture) {
     if (m_shapePtr && texture && !texture.isNull()) {
         m_shapePtr->setTexture(&texture->getTexture());
+        m_shapePtr->setTextureRect(texture->getTextureRect());
+        markChanged();
     }
 }
\ No newline at end of file
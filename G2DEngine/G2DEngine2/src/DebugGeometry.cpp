@@ -0,0 +1,132 @@
+#include "DebugGeometry.h"
+#include "Window.h"
+
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <array>
+#include <cmath>
+
+namespace {
+
+    constexpr int kDiscSegments = 12;
+
+    const std::array<sf::Vector2f, kDiscSegments + 1>& unitCircle() {
+        static const auto pts = [] {
+            std::array<sf::Vector2f, kDiscSegments + 1> out{};
+            for (int i = 0; i <= kDiscSegments; ++i) {
+                const float a = 6.2831853f * float(i) / float(kDiscSegments);
+                out[std::size_t(i)] = { std::cos(a), std::sin(a) };
+            }
+            return out;
+        }();
+        return pts;
+    }
+
+    // Círculo relleno como abanico de triángulos
+    void appendDisc(std::vector<sf::Vertex>& out, sf::Vector2f center, float radius, sf::Color col) {
+        const auto& unit = unitCircle();
+        for (int i = 0; i < kDiscSegments; ++i) {
+            out.push_back({ center, col });
+            out.push_back({ center + unit[std::size_t(i)] * radius, col });
+            out.push_back({ center + unit[std::size_t(i) + 1] * radius, col });
+        }
+    }
+
+    // Segmento a-b como quad de ancho width (2 triángulos)
+    void appendSegment(std::vector<sf::Vertex>& out, sf::Vector2f a, sf::Vector2f b, float width, sf::Color col) {
+        const sf::Vector2f d = b - a;
+        const float len = std::sqrt(d.x * d.x + d.y * d.y);
+        if (len <= 0.f) return;
+        const sf::Vector2f n{ -d.y / len * width * 0.5f, d.x / len * width * 0.5f };
+        const sf::Vertex quad[6] = {
+            { a + n, col }, { b + n, col }, { b - n, col },
+            { a + n, col }, { b - n, col }, { a - n, col },
+        };
+        out.insert(out.end(), quad, quad + 6);
+    }
+
+} // namespace
+
+DebugGeometry::DebugGeometry(sf::VertexBuffer::Usage usage)
+    : m_buffer(sf::PrimitiveType::Triangles, usage), m_useBuffer(sf::VertexBuffer::isAvailable()) {
+}
+
+bool DebugGeometry::isUpToDate(Kind kind, const std::vector<sf::Vector2f>& points, sf::Color color,
+    float radius, float lineWidth) const {
+    return m_kind == kind && m_color == color && m_radius == radius && m_lineWidth == lineWidth &&
+        m_points == points;
+}
+
+bool DebugGeometry::setClosedPath(const std::vector<sf::Vector2f>& points, sf::Color color,
+    float markerRadius, float lineWidth) {
+    if (isUpToDate(Kind::ClosedPath, points, color, markerRadius, lineWidth)) return false;
+    m_kind = Kind::ClosedPath;
+    m_points = points;
+    m_color = color;
+    m_radius = markerRadius;
+    m_lineWidth = lineWidth;
+
+    m_vertices.clear();
+    m_vertices.reserve(points.size() * (6 + 3 * kDiscSegments));
+    if (points.size() >= 2) {
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            appendSegment(m_vertices, points[i], points[(i + 1) % points.size()], lineWidth, color);
+        }
+    }
+    for (const auto& p : points) appendDisc(m_vertices, p, markerRadius, color);
+    upload();
+    return true;
+}
+
+bool DebugGeometry::setDiscs(const std::vector<sf::Vector2f>& centers, sf::Color color, float radius) {
+    if (isUpToDate(Kind::Discs, centers, color, radius, 0.f)) return false;
+    m_kind = Kind::Discs;
+    m_points = centers;
+    m_color = color;
+    m_radius = radius;
+    m_lineWidth = 0.f;
+
+    m_vertices.clear();
+    m_vertices.reserve(centers.size() * 3 * kDiscSegments);
+    for (const auto& c : centers) appendDisc(m_vertices, c, radius, color);
+    upload();
+    return true;
+}
+
+void DebugGeometry::clear() {
+    if (m_kind == Kind::None) return;
+    m_kind = Kind::None;
+    m_points.clear();
+    m_vertices.clear();
+    ++m_rebuilds;
+}
+
+void DebugGeometry::upload() {
+    ++m_rebuilds;
+    if (!m_useBuffer || m_vertices.empty()) return;
+
+    // create() solo si cambia el tamaño: el buffer dibuja todos sus vértices
+    if (m_buffer.getVertexCount() != m_vertices.size() && !m_buffer.create(m_vertices.size())) {
+        m_useBuffer = false;
+        return;
+    }
+    if (!m_buffer.update(m_vertices.data())) m_useBuffer = false;
+}
+
+void DebugGeometry::draw(Window& window) const {
+    if (m_vertices.empty()) return;
+    if (m_useBuffer) window.draw(m_buffer);
+    else window.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles);
+}
+
+void DebugGeometry::submit(RenderQueue& queue, RenderLayer layer, float depth) const {
+    if (m_vertices.empty()) return;
+    if (m_useBuffer) queue.submit(layer, depth, m_buffer, nullptr, m_vertices.size());
+    else queue.submit(layer, depth, m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles);
+}
+
+void DebugGeometry::drawTo(sf::RenderTarget& target) const {
+    if (m_vertices.empty()) return;
+    if (m_useBuffer) target.draw(m_buffer);
+    else target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles);
+}
@@ -2,57 +2,100 @@
 #include "CShape.h"
 #include "ECS/Transform.h"
 #include "ECS/Texture.h"
+#include "SpriteBatch.h"
 #include "Window.h"
 
+Actor::~Actor() {
+    // El Transform puede sobrevivir al actor si alguien más lo retiene
+    if (auto xf = getComponentPtr<Transform>()) {
+        xf->bindDrawables(nullptr, nullptr);
+    }
+}
+
 void Actor::update(float dt) {
     (void)dt;
-    auto xf = getComponent<Transform>();
-    if (!xf) return;
+    if (auto xf = getComponentPtr<Transform>()) {
+        xf->syncDrawables();
+    }
+}
 
-    if (auto shape = getComponent<CShape>()) {
-        if (auto raw = shape->getShape()) xf->applyTo(*raw);
+void Actor::bindDrawables() {
+    if (auto xf = getComponentPtr<Transform>()) {
+        xf->bindDrawables(getComponentPtr<CShape>(), getComponentPtr<Texture>());
     }
-    if (auto tex = getComponent<Texture>()) {
-        tex->setPosition(xf->getPosition());
-        auto s = xf->getScale();
-        if (s.x == 0.f && s.y == 0.f) s = { 1.f, 1.f }; // <- Fallback
-        tex->setScale(s);
-        tex->setRotation(xf->getRotation()); // en Texture.cpp usa sf::degrees(...)
+}
+
+bool Actor::fitsSlot(const Component& component, ComponentType type) {
+    switch (type) {
+    case Transform::StaticType: return dynamic_cast<const Transform*>(&component) != nullptr;
+    case CShape::StaticType:    return dynamic_cast<const CShape*>(&component) != nullptr;
+    case Texture::StaticType:   return dynamic_cast<const Texture*>(&component) != nullptr;
+    default:                    return false;
     }
 }
 
 void Actor::render(const EngineUtilities::TSharedPointer<Window>& window) {
-    // Solo el Track dibuja la shape (y nada más)
-    if (m_name == "Track") {
-        if (auto shape = getComponent<CShape>()) {
+    // Con la textura como relleno se dibuja la shape (y nada más): evita una segunda capa de mapa
+    if (m_textureFillsShape) {
+        if (auto shape = getComponentPtr<CShape>()) {
             shape->render(window);
         }
-        return; // <- evita dibujar el sprite del Track (segunda capa de mapa)
+        return;
     }
 
-    // Los demás actorean (racers) dibujan su sprite
-    if (auto textureComp = getComponent<Texture>()) {
+    // Los demás actores (racers) dibujan su sprite
+    if (auto textureComp = getComponentPtr<Texture>()) {
         textureComp->render(window);
     }
 }
 
+void Actor::renderBatched(SpriteBatch& batch) {
+    // La shape no va en lotes de sprites (se dibuja con render()); el resto, su sprite
+    if (m_textureFillsShape) return;
+
+    if (auto textureComp = getComponentPtr<Texture>()) {
+        textureComp->addToBatch(batch);
+    }
+}
+
+void Actor::renderTo(sf::RenderTarget& target) {
+    // Mismo reparto que render()
+    if (m_textureFillsShape) {
+        if (auto shape = getComponentPtr<CShape>()) shape->renderTo(target);
+        return;
+    }
+    if (auto textureComp = getComponentPtr<Texture>()) textureComp->renderTo(target);
+}
+
+void Actor::submit(RenderQueue& queue) {
+    // Mismo reparto que render(), pero encolado con la capa/profundidad del actor
+    if (m_textureFillsShape) {
+        if (auto shape = getComponentPtr<CShape>()) shape->submit(queue, m_renderLayer, m_renderDepth);
+        return;
+    }
+    if (auto textureComp = getComponentPtr<Texture>()) textureComp->submit(queue, m_renderLayer, m_renderDepth);
+}
+
 void Actor::setTexture(const EngineUtilities::TSharedPointer<Texture>& texture) {
     if (texture.isNull()) return;
 
-    // Reemplaza o agrega el componente Texture del actor
+    // Reemplaza o agrega el componente Texture del actor (lista + slot)
+    auto& slot = m_slots[Texture::StaticType];
     bool replaced = false;
     for (auto& comp : components) {
-        if (comp.template dynamic_pointer_cast<Texture>()) {
+        if (!slot.isNull() && comp.get() == slot.get()) {
             comp = texture;
             replaced = true;
             break;
         }
     }
     if (!replaced) components.push_back(texture);
+    slot = texture;
+    bindDrawables();
 
-    // Solo el actor "Track" recibe la textura en su CShape
-    if (m_name == "Track") {
-        if (auto shape = getComponent<CShape>()) {
+    // Solo los actores que usan la textura como relleno (la pista) la pasan a su CShape
+    if (m_textureFillsShape) {
+        if (auto shape = getComponentPtr<CShape>()) {
             shape->setTexture(texture);
         }
     }
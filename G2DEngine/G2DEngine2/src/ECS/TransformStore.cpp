@@ -0,0 +1,206 @@
+#include "ECS/TransformStore.h"
+#include "ECS/Texture.h"
+#include "CShape.h"
+
+#include <SFML/System/Angle.hpp>
+
+#include <cmath>
+
+namespace {
+
+    // Interpola ángulos en grados por el arco más corto
+    inline float lerpDegrees(float from, float to, float alpha) {
+        float delta = std::fmod(to - from, 360.f);
+        if (delta > 180.f) delta -= 360.f;
+        else if (delta < -180.f) delta += 360.f;
+        return from + delta * alpha;
+    }
+
+    // Dueño del almacén de un hilo; lo libera al terminar el hilo si ya no quedan transforms
+    struct StoreHolder {
+        TransformStore* store = new TransformStore();
+        ~StoreHolder() {
+            // Con transforms vivos (los estáticos del hilo principal se destruyen después) se
+            // conserva para que aún puedan liberar su índice
+            if (store->liveCount() == 0) delete store;
+        }
+    };
+
+} // namespace
+
+TransformStore& TransformStore::instance() {
+    thread_local StoreHolder holder;
+    return *holder.store;
+}
+
+TransformStore::Index TransformStore::create() {
+    Index i;
+    if (!m_free.empty()) {
+        i = m_free.back();
+        m_free.pop_back();
+        m_x[i] = 0.f;
+        m_y[i] = 0.f;
+        m_rot[i] = 0.f;
+        m_sx[i] = 1.f;
+        m_sy[i] = 1.f;
+    }
+    else {
+        i = static_cast<Index>(m_x.size());
+        m_x.push_back(0.f);
+        m_y.push_back(0.f);
+        m_rot.push_back(0.f);
+        m_sx.push_back(1.f);
+        m_sy.push_back(1.f);
+        m_version.push_back(0);
+        m_syncedVersion.push_back(0);
+        m_shapeVersion.push_back(0);
+        m_shapes.push_back(nullptr);
+        m_textures.push_back(nullptr);
+        m_interpolated.push_back(0);
+    }
+
+    // Un índice nuevo (o reciclado) siempre necesita su primera sincronización
+    m_syncedVersion[i] = m_version[i]++;
+    m_interpolated[i] = 0;
+    if (i < m_hasSnapshot.size()) m_hasSnapshot[i] = 0;
+    return i;
+}
+
+void TransformStore::release(Index i) {
+    if (i >= m_x.size()) return;
+    if (m_shapes[i]) m_shapes[i]->m_boundStore = nullptr;
+    m_shapes[i] = nullptr;
+    m_textures[i] = nullptr;
+    m_syncedVersion[i] = m_version[i];
+    if (i < m_hasSnapshot.size()) m_hasSnapshot[i] = 0;
+    m_free.push_back(i);
+}
+
+void TransformStore::reserve(std::size_t count) {
+    m_x.reserve(count);
+    m_y.reserve(count);
+    m_rot.reserve(count);
+    m_sx.reserve(count);
+    m_sy.reserve(count);
+    m_version.reserve(count);
+    m_syncedVersion.reserve(count);
+    m_shapeVersion.reserve(count);
+    m_shapes.reserve(count);
+    m_textures.reserve(count);
+    m_interpolated.reserve(count);
+    m_free.reserve(count);
+}
+
+void TransformStore::bind(Index i, CShape* shape, Texture* texture) {
+    if (m_shapes[i] && m_shapes[i] != shape) m_shapes[i]->m_boundStore = nullptr;
+    if (shape) {
+        // Una forma sigue a un solo Transform: se suelta del anterior
+        if (shape->m_boundStore && (shape->m_boundStore != this || shape->m_boundIndex != i)) {
+            shape->m_boundStore->unbindShape(shape->m_boundIndex, shape);
+        }
+        shape->m_boundStore = this;
+        shape->m_boundIndex = i;
+    }
+    m_shapes[i] = shape;
+    m_textures[i] = texture;
+    m_syncedVersion[i] = m_version[i] - 1; // los drawables nuevos aún no tienen el transform
+}
+
+void TransformStore::unbindShape(Index i, const CShape* shape) {
+    if (i < m_shapes.size() && m_shapes[i] == shape) m_shapes[i] = nullptr;
+}
+
+void TransformStore::snapshot() {
+    m_prevX = m_x;
+    m_prevY = m_y;
+    m_prevRot = m_rot;
+    m_snapshotVersion = m_version;
+    m_hasSnapshot.assign(m_x.size(), 1);
+    for (Index i : m_free) m_hasSnapshot[i] = 0;
+    m_snapshotTaken = true;
+}
+
+std::size_t TransformStore::syncDrawables(float alpha) {
+    const bool interpolate = alpha < 1.f;
+    const float a = alpha < 0.f ? 0.f : alpha;
+    const std::size_t snapshotSize = m_hasSnapshot.size();
+
+    // Mismo snapshot y mismo alpha que la pasada anterior (p.ej. en pausa): lo interpolado sigue valiendo
+    const bool sameInterpolation = interpolate && !m_snapshotTaken && a == m_lastAlpha;
+    m_snapshotTaken = false;
+    m_lastAlpha = interpolate ? a : -1.f;
+
+    // Si ninguna CShape cambió desde la última pasada no hace falta mirar sus versiones
+    const std::uint32_t epoch = CShape::changeEpoch();
+    const bool shapesChanged = epoch != m_shapeEpoch;
+    m_shapeEpoch = epoch;
+
+    SyncStats stats;
+    const std::size_t n = m_version.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        CShape* shape = m_shapes[i];
+        if (!shape && !m_textures[i]) continue; // sin drawables: nada que copiar
+
+        const bool changed = m_version[i] != m_syncedVersion[i]
+            || (shapesChanged && shape && shape->getVersion() != m_shapeVersion[i]);
+
+        // Se movió desde el snapshot: se dibuja entre el estado anterior y el actual
+        if (interpolate && i < snapshotSize && m_hasSnapshot[i] && m_version[i] != m_snapshotVersion[i]) {
+            if (sameInterpolation && m_interpolated[i] && !changed) {
+                ++stats.skipped;
+                continue;
+            }
+            const sf::Vector2f pos{ m_prevX[i] + (m_x[i] - m_prevX[i]) * a,
+                                    m_prevY[i] + (m_y[i] - m_prevY[i]) * a };
+            writeDrawables(static_cast<Index>(i), pos, lerpDegrees(m_prevRot[i], m_rot[i], a));
+            m_syncedVersion[i] = m_version[i];
+            m_interpolated[i] = 1; // lo dibujado no es el estado actual
+            ++stats.synced;
+            continue;
+        }
+
+        if (changed || m_interpolated[i]) {
+            writeDrawables(static_cast<Index>(i));
+            ++stats.synced;
+        }
+        else {
+            ++stats.skipped;
+        }
+    }
+    m_lastStats = stats;
+    return stats.synced;
+}
+
+void TransformStore::syncOne(Index i) {
+    if (needsSync(i)) writeDrawables(i);
+}
+
+bool TransformStore::needsSync(Index i) const {
+    if (m_version[i] != m_syncedVersion[i] || m_interpolated[i]) return true;
+    const CShape* shape = m_shapes[i];
+    return shape && shape->getVersion() != m_shapeVersion[i];
+}
+
+void TransformStore::writeDrawables(Index i) {
+    m_syncedVersion[i] = m_version[i];
+    m_interpolated[i] = 0;
+    writeDrawables(i, { m_x[i], m_y[i] }, m_rot[i]);
+}
+
+void TransformStore::writeDrawables(Index i, const sf::Vector2f& pos, float rotation) {
+    const sf::Vector2f scale{ m_sx[i], m_sy[i] };
+
+    if (CShape* shape = m_shapes[i]) {
+        if (sf::Shape* raw = shape->getShape()) {
+            raw->setPosition(pos);
+            raw->setRotation(sf::degrees(rotation));
+            raw->setScale(scale);
+        }
+        m_shapeVersion[i] = shape->getVersion();
+    }
+    if (Texture* tex = m_textures[i]) {
+        tex->setPosition(pos);
+        tex->setScale((scale.x == 0.f && scale.y == 0.f) ? sf::Vector2f{ 1.f, 1.f } : scale); // <- Fallback
+        tex->setRotation(rotation);
+    }
+}
@@ -2,6 +2,7 @@
 #include "Window.h"
 #include "A_Racer.h"
 #include <algorithm>
+#include <cstdio>
 #include "../../ThirdParties/imgui-sfml-master/imgui-SFML.h"
 
 // Inicializa ImGui con la ventana y establece el tema actual
@@ -31,26 +32,20 @@ void EngineGUI::update(const EngineUtilities::TSharedPointer<Window>& window,
     // Ventana con la lista de corredores y su progreso
     ImGui::Begin("Racers / Podio", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
 
-    // Copia la lista para ordenarla por progreso descendente
-    auto sorted = m_racers;
-    std::sort(sorted.begin(), sorted.end(),
-        [](auto& a, auto& b) {
-            return a->getProgress() > b->getProgress();
-        });
-
+    // m_racers ya viene en orden de clasificacin (RaceWorld::getStandings), sin reordenar aqu
     int idx = 1;
-    for (auto& r : sorted) {
-        // Construye el texto con nombre, posicin y progreso en porcentaje
-        std::string label = std::to_string(idx) + ". " +
-            r->getName() +
-            " (P" + std::to_string(r->getPlace() ? r->getPlace() : idx) + ")";
-        char buf[32];
-        std::snprintf(buf, 32, "%.1f%%", r->getProgress() * 100.f);
+    for (const auto& weak : m_racers) {
+        auto r = weak.lock();
+        if (!r) continue;
 
-        ImGui::Text("%s %s", label.c_str(), buf);
+        // Nombre, posicin y progreso en porcentaje (formateado por ImGui, sin std::string)
+        ImGui::Text("%d. %s (P%d) %.1f%%", idx, r->getName().c_str(),
+            r->getPlace() ? r->getPlace() : idx, r->getProgress() * 100.f);
 
         // Botn para reiniciar el corredor
-        if (ImGui::SmallButton(("Reset##" + std::to_string(idx)).c_str()))
+        char buttonId[24];
+        std::snprintf(buttonId, sizeof(buttonId), "Reset##%d", idx);
+        if (ImGui::SmallButton(buttonId))
             r->reset();
 
         idx++;
@@ -138,6 +133,12 @@ void EngineGUI::renderControlPanel()
 
     ImGui::SliderFloat("Speed Mul", &m_speedMultiplier, 0.1f, 3.f, "%.2f");
 
+    ImGui::SliderInt("Sim Hz", &m_simulationHz, 10, 240);
+    ImGui::SliderInt("Max substeps", &m_maxSubsteps, 1, 16);
+    ImGui::Checkbox("Interpolate", &m_interpolate);
+    ImGui::Checkbox("Batch sprites", &m_batchSprites);
+    ImGui::Checkbox("Static layer", &m_staticLayer);
+
     if (ImGui::Button("Exit")) m_requestQuit = true;
 
     ImGui::End();
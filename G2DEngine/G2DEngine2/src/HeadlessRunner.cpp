@@ -0,0 +1,103 @@
+#include "HeadlessRunner.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+HeadlessRunner::Options HeadlessRunner::parseOptions(int argc, char** argv) {
+    Options o;
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--races") && i + 1 < argc) o.races = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--laps") && i + 1 < argc) o.laps = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--dt") && i + 1 < argc) o.dt = float(std::atof(argv[++i]));
+        else if (!std::strcmp(argv[i], "--max-time") && i + 1 < argc) o.maxRaceTime = float(std::atof(argv[++i]));
+        else if (!std::strcmp(argv[i], "--steering") && i + 1 < argc) {
+            o.steering = std::strcmp(argv[++i], "per-racer") ? RaceWorld::SteeringMode::Batched
+                                                             : RaceWorld::SteeringMode::PerRacer;
+        }
+    }
+    if (o.races < 1) o.races = 1;
+    if (o.laps < 1) o.laps = 1;
+    if (!(o.dt > 0.f)) o.dt = 1.f / 60.f;
+    return o;
+}
+
+bool HeadlessRunner::isRequested(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--headless")) return true;
+    }
+    return false;
+}
+
+sf::FloatRect HeadlessRunner::finishLineAtStart(const std::vector<sf::Vector2f>& path, float size, float ahead) {
+    if (path.empty()) return {};
+    if (path.size() < 2) return sf::FloatRect{ path.front() - sf::Vector2f{ size * 0.5f, size * 0.5f }, { size, size } };
+
+    const TrackPath track(path);
+    const float distance = track.wrap(ahead);
+    const sf::Vector2f center = track.pointAt(distance);
+    const int seg = track.segmentAt(distance);
+    const sf::Vector2f dir = path[(seg + 1) % path.size()] - path[seg];
+
+    // Estrecho en el sentido de la marcha y largo a lo ancho de la pista
+    const sf::Vector2f extent = std::abs(dir.x) >= std::abs(dir.y)
+        ? sf::Vector2f{ size * 0.25f, size } : sf::Vector2f{ size, size * 0.25f };
+    return sf::FloatRect{ center - extent * 0.5f, extent };
+}
+
+int HeadlessRunner::run() {
+    m_race.buildDefault(m_options.laps);
+    m_race.setSteeringMode(m_options.steering);
+    // La meta de BaseApp queda fuera de la ruta por defecto; aquí se coloca sobre ella
+    m_race.setFinishLine(finishLineAtStart(m_race.getPath(), 64.f, 320.f));
+
+    std::printf("Headless: %d races, %d laps, %zu racers, dt=%.4f s, %s steering\n",
+        m_options.races, m_options.laps, m_race.getRacers().size(), m_options.dt,
+        m_options.steering == RaceWorld::SteeringMode::Batched ? "batched" : "per-racer");
+
+    std::size_t steps = 0;
+    int timedOut = 0;
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int race = 0; race < m_options.races; ++race) {
+        if (race > 0) m_race.reset();
+
+        while (!m_race.isFinished() && m_race.getRaceTime() < m_options.maxRaceTime) {
+            m_race.step(m_options.dt);
+            ++steps;
+        }
+        if (!m_race.isFinished()) ++timedOut;
+    }
+
+    const double wallSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double safeSec = wallSec > 0.0 ? wallSec : 1e-9;
+    std::printf("Simulated %zu steps in %.3f s: %.1f races/s, %.0f steps/s\n",
+        steps, wallSec, m_options.races / safeSec, double(steps) / safeSec);
+
+    printStandings(m_options.races);
+
+    if (timedOut > 0) {
+        std::printf("%d race(s) hit --max-time %.0f s before every racer finished\n",
+            timedOut, m_options.maxRaceTime);
+        return 1;
+    }
+    return 0;
+}
+
+void HeadlessRunner::printStandings(int raceNumber) const {
+    std::printf("Final standings (race %d, %.2f s simulated):\n", raceNumber, m_race.getRaceTime());
+
+    const auto& order = m_race.getFinishedOrder();
+    const auto& times = m_race.getFinishTimes();
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        std::printf("  %zu. %-8s %8.2f s\n", i + 1, order[i]->getName().c_str(), times[i]);
+    }
+    for (const auto& r : m_race.getRacers()) {
+        if (r && r->getPlace() == 0) {
+            std::printf("  --  %-8s DNF (lap %d/%d)\n", r->getName().c_str(),
+                r->getCurrentLap(), r->getTotalLaps());
+        }
+    }
+}
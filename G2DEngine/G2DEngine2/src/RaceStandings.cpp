@@ -0,0 +1,29 @@
+#include "RaceStandings.h"
+
+void RaceStandings::reset(std::size_t count) {
+    m_keys.assign(count, 0.0);
+    m_order.resize(count);
+    for (std::size_t i = 0; i < count; ++i) m_order[i] = static_cast<std::uint32_t>(i);
+    m_lastSwaps = 0;
+}
+
+std::size_t RaceStandings::repair() {
+    // Inserción sobre el orden anterior: casi ordenado, así que casi no mueve nada
+    std::size_t swaps = 0;
+    const std::size_t n = m_order.size();
+    for (std::size_t i = 1; i < n; ++i) {
+        const std::uint32_t racer = m_order[i];
+        const double key = m_keys[racer];
+        std::size_t j = i;
+        while (j > 0 && m_keys[m_order[j - 1]] < key) {
+            m_order[j] = m_order[j - 1];
+            --j;
+        }
+        if (j != i) {
+            m_order[j] = racer;
+            swaps += i - j;
+        }
+    }
+    m_lastSwaps = swaps;
+    return swaps;
+}
@@ -0,0 +1,239 @@
+#include "RaceWorld.h"
+#include "ECS/Transform.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace { // ------- helpers de geometría -------
+
+    inline float vlen(const sf::Vector2f& v) { return std::sqrt(v.x * v.x + v.y * v.y); }
+
+} // namespace
+
+std::vector<sf::Vector2f> RaceWorld::densifyClosed(const std::vector<sf::Vector2f>& pts, float maxSegLen) {
+    std::vector<sf::Vector2f> out;
+    if (pts.size() < 2) return out;
+    const int N = (int)pts.size();
+    out.reserve(N * 4);
+    for (int i = 0; i < N; ++i) {
+        const sf::Vector2f A = pts[i];
+        const sf::Vector2f B = pts[(i + 1) % N];
+        out.push_back(A);
+        const float d = vlen(B - A);
+        if (d > maxSegLen) {
+            int steps = std::max(1, (int)std::floor(d / maxSegLen));
+            sf::Vector2f dir = (B - A) * (1.f / (float)(steps + 1));
+            for (int k = 1; k <= steps; ++k) out.push_back(A + dir * (float)k);
+        }
+    }
+    return out;
+}
+
+std::vector<sf::Vector2f> RaceWorld::offsetClosed(const std::vector<sf::Vector2f>& path, float offsetPx) {
+    return TrackPath::offsetPoints(path, offsetPx);
+}
+
+void RaceWorld::buildDefault(int laps) {
+    // Ruta inicial mínima (se puede reemplazar dibujando otra en el editor)
+    m_track = TrackPath::create(densifyClosed({
+        {100.f,150.f}, {300.f,140.f}, {500.f,160.f}, {700.f,300.f},
+        {900.f,280.f}, {1100.f,500.f}, {1300.f,480.f}, {1500.f,450.f}
+    }, 30.f));
+
+    // Corredores
+    auto r1 = EngineUtilities::MakeShared<A_Racer>("YOSHI", 1);
+    auto r2 = EngineUtilities::MakeShared<A_Racer>("MARIO", 2);
+    auto r3 = EngineUtilities::MakeShared<A_Racer>("SONIC", 3);
+    auto r4 = EngineUtilities::MakeShared<A_Racer>("RAYO", 4);
+
+    // Carriles por offset sobre la misma ruta (valores moderados; ajusta según ancho de pista)
+    r1->setTrack(m_track, 0.f);
+    r2->setTrack(m_track, +8.f);
+    r3->setTrack(m_track, -8.f);
+    r4->setTrack(m_track, +16.f);
+
+    // Grid de salida
+    r1->getComponent<Transform>()->setPosition(r1->getPath().front() + sf::Vector2f{ 0.f,  0.f });
+    r2->getComponent<Transform>()->setPosition(r2->getPath().front() + sf::Vector2f{ 0.f, 16.f });
+    r3->getComponent<Transform>()->setPosition(r3->getPath().front() + sf::Vector2f{ 16.f,  0.f });
+    r4->getComponent<Transform>()->setPosition(r4->getPath().front() + sf::Vector2f{ 16.f, 16.f });
+
+    m_racers = { r1, r2, r3, r4 };
+    setTotalLaps(laps);
+
+    m_finishedOrder.clear();
+    m_finishTimes.clear();
+    m_raceTime = 0.f;
+    rebuildStandings();
+}
+
+void RaceWorld::setPath(const std::vector<sf::Vector2f>& path, const std::vector<float>& laneOffsets) {
+    m_track = TrackPath::create(path);
+
+    // Cada corredor referencia la misma ruta; los carriles se calculan una vez por offset.
+    // Sin offsets cada uno conserva el suyo, pero siempre sobre la ruta nueva
+    for (std::size_t i = 0; i < m_racers.size(); ++i) {
+        if (!m_racers[i]) continue;
+        const float offset = laneOffsets.empty() ? m_racers[i]->getLaneOffset()
+            : laneOffsets[std::min<std::size_t>(i, laneOffsets.size() - 1)];
+        m_racers[i]->setTrack(m_track, offset);
+    }
+}
+
+void RaceWorld::setFinishLine(const sf::FloatRect& finishLine) {
+    m_finishLine = finishLine;
+    for (auto& r : m_racers) {
+        if (r) r->setFinishLine(m_finishLine);
+    }
+}
+
+void RaceWorld::setTotalLaps(int laps) {
+    for (auto& r : m_racers) {
+        if (r) r->setTotalLaps(laps);
+    }
+}
+
+void RaceWorld::step(float dt) {
+    m_raceTime += dt;
+
+    if (m_steeringMode == SteeringMode::Batched) stepBatched(dt);
+
+    for (auto& r : m_racers) {
+        if (!r) continue;
+
+        if (m_steeringMode == SteeringMode::PerRacer) r->update(dt);
+    }
+
+    applySeparation(dt);
+
+    // Vueltas completadas en este paso, fechadas en el punto del movimiento donde se cruzó la meta
+    m_stepFinishers.clear();
+    for (std::size_t i = 0; i < m_racers.size(); ++i) {
+        A_Racer* r = m_racers[i].get();
+        if (!r) continue;
+
+        auto& laps = m_lapTimes[i];
+        if (r->getCurrentLap() > int(laps.size())) {
+            const float crossTime = m_raceTime - dt * (1.f - r->getLapCrossFraction());
+            laps.resize(std::size_t(r->getCurrentLap()), crossTime);
+        }
+
+        if (r->getPlace() == 0 && r->isFinished()) {
+            m_stepFinishers.push_back({ laps.empty() ? m_raceTime : laps.back(), i });
+        }
+    }
+
+    // Varios corredores pueden terminar en el mismo paso: los ordena su tiempo de cruce
+    std::sort(m_stepFinishers.begin(), m_stepFinishers.end());
+    for (const auto& [time, i] : m_stepFinishers) {
+        const RacerPtr& r = m_racers[i];
+        r->setPlace(int(m_finishedOrder.size()) + 1);
+        m_finishedOrder.push_back(r);
+        m_finishTimes.push_back(time);
+    }
+
+    updateStandings();
+}
+
+void RaceWorld::stepBatched(float dt) {
+    m_steering.clear();
+    m_steeringRacers.clear();
+
+    for (auto& r : m_racers) {
+        if (!r || !r->isSteering()) continue;
+        auto xf = r->getComponentPtr<Transform>();
+        if (!xf) continue;
+
+        const auto& path = r->getPath();
+        m_steering.add(path.data(), (int)path.size(), r->getWaypointIndex(),
+            xf->getPosition(), xf->getRotation(), r->getSteeringParams());
+        m_steeringRacers.push_back(r.get());
+    }
+
+    m_steering.stepSimd(dt);
+
+    for (std::size_t i = 0; i < m_steeringRacers.size(); ++i) {
+        A_Racer* r = m_steeringRacers[i];
+        r->applySteering(m_steering.getPosition(i), m_steering.getRotation(i),
+            m_steering.getWaypoint(i), m_steering.moved(i));
+        r->updateLap();
+    }
+}
+
+void RaceWorld::setSeparation(float radius, float strength) {
+    m_separationRadius = std::max(radius, 0.f);
+    m_separationStrength = std::max(strength, 0.f);
+    if (m_separationRadius > 0.f) m_grid.setCellSize(m_separationRadius);
+}
+
+void RaceWorld::applySeparation(float dt) {
+    m_gridRacers.clear();
+    m_gridX.clear();
+    m_gridY.clear();
+    for (auto& r : m_racers) {
+        if (!r || !r->isSteering()) continue;
+        auto xf = r->getComponentPtr<Transform>();
+        if (!xf) continue;
+        const sf::Vector2f p = xf->getPosition();
+        m_gridRacers.push_back(r.get());
+        m_gridX.push_back(p.x);
+        m_gridY.push_back(p.y);
+    }
+    m_grid.build(m_gridX.data(), m_gridY.data(), m_gridRacers.size());
+
+    if (m_separationStrength <= 0.f || m_separationRadius <= 0.f || m_gridRacers.size() < 2) return;
+
+    // Empuje lineal: máximo al solaparse, cero en el radio. Se calcula con las posiciones de
+    // la rejilla (no las ya corregidas) para que el resultado no dependa del orden.
+    const float radius = m_separationRadius;
+    const float push = m_separationStrength * dt;
+    for (std::size_t i = 0; i < m_gridRacers.size(); ++i) {
+        const sf::Vector2f p{ m_gridX[i], m_gridY[i] };
+        sf::Vector2f away{ 0.f, 0.f };
+        m_grid.forEachInRadius(p, radius, [&](SpatialHashGrid::Index j, float d2) {
+            if (j == i || d2 <= 1e-8f) return;
+            const float d = std::sqrt(d2);
+            const sf::Vector2f q = m_grid.getPoint(j);
+            away += (p - q) * ((1.f - d / radius) / d);
+        });
+        if (away.x == 0.f && away.y == 0.f) continue;
+
+        // Nunca más de push px por paso, aunque haya muchos vecinos
+        const float len = vlen(away);
+        if (len > 1.f) away /= len;
+        m_gridRacers[i]->getComponentPtr<Transform>()->setPosition(p + away * push);
+    }
+}
+
+void RaceWorld::reset() {
+    for (auto& r : m_racers) if (r) r->reset();
+    m_finishedOrder.clear();
+    m_finishTimes.clear();
+    m_raceTime = 0.f;
+    rebuildStandings();
+}
+
+void RaceWorld::rebuildStandings() {
+    m_lapTimes.assign(m_racers.size(), {});
+    m_standings.reset(m_racers.size());
+    m_standingsOrder = m_racers;
+    updateStandings();
+}
+
+void RaceWorld::updateStandings() {
+    // Los que terminaron van delante, por orden de llegada; el resto por avance en la ruta
+    constexpr double kFinishedKey = 1e15;
+    const std::size_t swaps = m_standings.update([this](std::size_t i) {
+        const A_Racer* r = m_racers[i].get();
+        if (!r) return -kFinishedKey;
+        return r->getPlace() > 0 ? kFinishedKey - r->getPlace() : r->getRaceProgress();
+    });
+    if (swaps == 0) return;
+
+    const auto& order = m_standings.order();
+    for (std::size_t i = 0; i < order.size(); ++i) m_standingsOrder[i] = m_racers[order[i]];
+}
+
+bool RaceWorld::isFinished() const {
+    return !m_racers.empty() && m_finishedOrder.size() == m_racers.size();
+}
@@ -0,0 +1,98 @@
+#include "RenderQueue.h"
+
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+    constexpr std::uint32_t kTextureBits = 8;
+    constexpr std::uint32_t kSequenceBits = 20;
+
+    // Entero sin signo con el mismo orden que el float (los negativos quedan por debajo)
+    inline std::uint32_t orderedBits(float value) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    }
+
+} // namespace
+
+std::uint64_t RenderQueue::makeKey(RenderLayer layer, float depth, std::uint32_t textureId, std::uint32_t sequence,
+    RenderSort mode) {
+    const std::uint64_t layerBits = std::uint64_t(std::uint8_t(layer) & 0xFu);
+    const std::uint64_t depthBits = std::uint64_t(orderedBits(depth));
+    // En modo Submission la textura no entra: el orden de envío decide solo
+    const std::uint64_t textureBits = mode == RenderSort::Texture
+        ? std::uint64_t(std::min(textureId, (1u << kTextureBits) - 1u)) : 0u;
+    const std::uint64_t sequenceBits = std::uint64_t(std::min(sequence, (1u << kSequenceBits) - 1u));
+    return (layerBits << 60) | (depthBits << (kTextureBits + kSequenceBits)) | (textureBits << kSequenceBits) | sequenceBits;
+}
+
+std::uint32_t RenderQueue::textureId(const sf::Texture* texture) {
+    if (!texture) return 0;
+    // Pocas texturas por frame: búsqueda lineal, empezando por la última (suelen llegar seguidas)
+    for (std::size_t i = m_textures.size(); i-- > 0;) {
+        if (m_textures[i] == texture) return std::uint32_t(i + 1);
+    }
+    m_textures.push_back(texture);
+    return std::uint32_t(m_textures.size());
+}
+
+void RenderQueue::push(RenderLayer layer, float depth, RenderCommand command) {
+    const RenderSort mode = getSortMode(layer);
+    const std::uint32_t texture = mode == RenderSort::Texture ? textureId(command.texture) : 0u;
+    command.key = makeKey(layer, depth, texture, std::uint32_t(m_commands.size()), mode);
+    m_commands.push_back(command);
+}
+
+void RenderQueue::submit(RenderLayer layer, float depth, const sf::Sprite& sprite) {
+    RenderCommand c;
+    c.texture = &sprite.getTexture();
+    c.drawable = &sprite;
+    c.vertexCount = 4;
+    push(layer, depth, c);
+}
+
+void RenderQueue::submit(RenderLayer layer, float depth, const sf::Shape& shape) {
+    // sf::Shape dibuja un abanico (puntos + centro + cierre) y, si tiene grosor, el contorno
+    const std::size_t points = shape.getPointCount();
+    RenderCommand c;
+    c.texture = shape.getTexture();
+    c.drawable = &shape;
+    c.vertexCount = points + 2 + (shape.getOutlineThickness() != 0.f ? (points + 1) * 2 : 0);
+    push(layer, depth, c);
+}
+
+void RenderQueue::submit(RenderLayer layer, float depth, const sf::Drawable& drawable,
+    const sf::Texture* texture, std::size_t vertexCount) {
+    RenderCommand c;
+    c.texture = texture;
+    c.drawable = &drawable;
+    c.vertexCount = vertexCount;
+    push(layer, depth, c);
+}
+
+void RenderQueue::submit(RenderLayer layer, float depth, const sf::Vertex* vertices, std::size_t vertexCount,
+    sf::PrimitiveType primitive, const sf::Texture* texture) {
+    if (!vertices || vertexCount == 0) return;
+    RenderCommand c;
+    c.texture = texture;
+    c.vertices = vertices;
+    c.vertexCount = vertexCount;
+    c.primitive = primitive;
+    push(layer, depth, c);
+}
+
+void RenderQueue::sort() {
+    // El orden de envío va en la clave, así que std::sort (sin búfer auxiliar) ya es estable
+    std::sort(m_commands.begin(), m_commands.end(),
+        [](const RenderCommand& a, const RenderCommand& b) { return a.key < b.key; });
+}
+
+void RenderQueue::clear() {
+    m_commands.clear();
+    m_textures.clear();
+}
@@ -14,7 +14,7 @@ bool ResourceManager::loadTexture(const std::string& fileName, const std::string
     std::filesystem::path fullPath = std::filesystem::absolute(fullName);
 
     // Intentar cargar
-    auto texturePtr = EngineUtilities::MakeShared<Texture>(fileName, extension);
+    auto texturePtr = EngineUtilities::MakePooled<Texture>(fileName, extension);
     // El constructor de Texture ya intenta cargar y emplace el sprite solo si tiene xito.
     // Pero verificamos si la textura interna se carg correctamente inspeccionando si el sprite est presente.
 
@@ -29,6 +29,27 @@ bool ResourceManager::loadTexture(const std::string& fileName, const std::string
     return !texturePtr.isNull();
 }
 
+bool ResourceManager::loadAtlas(const std::vector<std::string>& fileNames, const std::string& extension,
+    const std::string& cacheDir) {
+    m_atlas.build(fileNames, extension, cacheDir);
+
+    bool allLoaded = true;
+    for (const auto& fileName : fileNames) {
+        // Las ya cargadas se respetan, igual que en loadTexture
+        auto it = m_textures.find(fileName);
+        if (it != m_textures.end() && !it->second.isNull()) continue;
+
+        const TextureAtlas::Entry* entry = m_atlas.find(fileName);
+        if (entry && entry->page >= 0) {
+            m_textures[fileName] = EngineUtilities::MakePooled<Texture>(fileName, m_atlas.getPage(entry->page), entry->rect);
+        }
+        else if (!loadTexture(fileName, extension)) {
+            allLoaded = false;
+        }
+    }
+    return allLoaded;
+}
+
 EngineUtilities::TSharedPointer<Texture> ResourceManager::getTexture(const std::string& fileName) {
     auto it = m_textures.find(fileName);
     if (it != m_textures.end()) {
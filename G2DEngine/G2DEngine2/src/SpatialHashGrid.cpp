@@ -0,0 +1,81 @@
+#include "SpatialHashGrid.h"
+
+#include <algorithm>
+
+void SpatialHashGrid::build(const float* xs, const float* ys, std::size_t count) {
+    m_x.assign(xs, xs + count);
+    m_y.assign(ys, ys + count);
+
+    // Rejilla ajustada a la caja envolvente de los puntos
+    float minX = 0.f, minY = 0.f, maxX = 0.f, maxY = 0.f;
+    if (count > 0) {
+        const auto [loX, hiX] = std::minmax_element(m_x.begin(), m_x.end());
+        const auto [loY, hiY] = std::minmax_element(m_y.begin(), m_y.end());
+        minX = *loX; maxX = *hiX;
+        minY = *loY; maxY = *hiY;
+    }
+
+    // Como mucho ~4 celdas por punto (y al menos 1024): si no caben, celdas más grandes
+    const double maxCells = double(std::max<std::size_t>(count * 4, 1024));
+    float step = m_cellSize;
+    for (;;) {
+        const double cols = std::floor((maxX - minX) / step) + 1.0;
+        const double rows = std::floor((maxY - minY) / step) + 1.0;
+        if (cols * rows <= maxCells) {
+            m_cols = int(cols);
+            m_rows = int(rows);
+            break;
+        }
+        step *= 2.f;
+    }
+    m_originX = minX;
+    m_originY = minY;
+    m_invStep = 1.f / step;
+
+    // Counting sort por celda: contar, acumular, repartir
+    const std::size_t cells = std::size_t(m_cols) * std::size_t(m_rows);
+    m_cellStart.assign(cells + 1, 0);
+    m_cellOf.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const Index cell = Index(cellY(m_y[i])) * Index(m_cols) + Index(cellX(m_x[i]));
+        m_cellOf[i] = cell;
+        ++m_cellStart[cell + 1];
+    }
+    for (std::size_t c = 0; c < cells; ++c) m_cellStart[c + 1] += m_cellStart[c];
+
+    m_entries.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        // Usa m_cellStart[cell] como cursor de escritura y lo restaura después
+        m_entries[m_cellStart[m_cellOf[i]]++] = Index(i);
+    }
+    for (std::size_t c = cells; c > 0; --c) m_cellStart[c] = m_cellStart[c - 1];
+    m_cellStart[0] = 0;
+}
+
+std::size_t SpatialHashGrid::queryRadius(const sf::Vector2f& pos, float radius, std::vector<Index>& out) const {
+    out.clear();
+    forEachInRadius(pos, radius, [&](Index i, float) { out.push_back(i); });
+    return out.size();
+}
+
+std::size_t SpatialHashGrid::nearestK(const sf::Vector2f& pos, std::size_t k, std::vector<Index>& out,
+    float maxRadius, Index exclude) const {
+    out.clear();
+    if (k == 0 || m_x.empty()) return 0;
+
+    // Anillos crecientes hasta reunir k candidatos (o llegar a maxRadius)
+    float radius = std::min(1.f / m_invStep, maxRadius);
+    for (;;) {
+        m_candidates.clear();
+        forEachInRadius(pos, radius, [&](Index i, float d2) {
+            if (i != exclude) m_candidates.emplace_back(d2, i);
+        });
+        if (m_candidates.size() >= k || radius >= maxRadius) break;
+        radius = std::min(radius * 2.f, maxRadius);
+    }
+
+    const std::size_t found = std::min(k, m_candidates.size());
+    std::partial_sort(m_candidates.begin(), m_candidates.begin() + found, m_candidates.end());
+    for (std::size_t i = 0; i < found; ++i) out.push_back(m_candidates[i].second);
+    return found;
+}
@@ -0,0 +1,102 @@
+#include "SpriteBatch.h"
+#include "Window.h"
+
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+void SpriteBatch::begin(const sf::FloatRect& view) {
+    for (std::size_t i = 0; i < m_used; ++i) m_batches[i].vertices.clear();
+    m_used = 0;
+    m_lastBatch = 0;
+    m_view = view;
+    m_sprites = 0;
+    m_culled = 0;
+}
+
+SpriteBatch::Batch& SpriteBatch::batchFor(const sf::Texture& texture) {
+    if (m_lastBatch < m_used && m_batches[m_lastBatch].texture == &texture) return m_batches[m_lastBatch];
+
+    for (std::size_t i = 0; i < m_used; ++i) {
+        if (m_batches[i].texture == &texture) {
+            m_lastBatch = i;
+            return m_batches[i];
+        }
+    }
+
+    // Textura nueva en este frame: reutiliza un lote de frames anteriores si queda alguno
+    if (m_used == m_batches.size()) m_batches.emplace_back();
+    Batch& batch = m_batches[m_used];
+    batch.texture = &texture;
+    batch.vertices.clear();
+    m_lastBatch = m_used++;
+    return batch;
+}
+
+void SpriteBatch::add(const sf::Texture& texture, const sf::IntRect& textureRect, const sf::Vector2f& position,
+    float rotationDeg, const sf::Vector2f& scale, const sf::Vector2f& origin, sf::Color color) {
+    ++m_sprites;
+
+    // Transform del sprite en CPU: escala y rota las esquinas alrededor del origen
+    const float rad = rotationDeg * 0.01745329252f;
+    const float c = std::cos(rad), s = std::sin(rad);
+    const sf::Vector2f size{ float(textureRect.size.x), float(textureRect.size.y) };
+    auto corner = [&](float lx, float ly) {
+        const float x = (lx - origin.x) * scale.x;
+        const float y = (ly - origin.y) * scale.y;
+        return sf::Vector2f{ position.x + x * c - y * s, position.y + x * s + y * c };
+    };
+    const sf::Vector2f p0 = corner(0.f, 0.f), p1 = corner(size.x, 0.f);
+    const sf::Vector2f p2 = corner(size.x, size.y), p3 = corner(0.f, size.y);
+
+    if (m_view.size.x > 0.f && m_view.size.y > 0.f) {
+        const float minX = std::min({ p0.x, p1.x, p2.x, p3.x }), maxX = std::max({ p0.x, p1.x, p2.x, p3.x });
+        const float minY = std::min({ p0.y, p1.y, p2.y, p3.y }), maxY = std::max({ p0.y, p1.y, p2.y, p3.y });
+        if (maxX < m_view.position.x || minX > m_view.position.x + m_view.size.x ||
+            maxY < m_view.position.y || minY > m_view.position.y + m_view.size.y) {
+            ++m_culled;
+            return;
+        }
+    }
+
+    const float u0 = float(textureRect.position.x), v0 = float(textureRect.position.y);
+    const float u1 = u0 + size.x, v1 = v0 + size.y;
+    const sf::Vertex quad[6] = {
+        { p0, color, { u0, v0 } }, { p1, color, { u1, v0 } }, { p2, color, { u1, v1 } },
+        { p0, color, { u0, v0 } }, { p2, color, { u1, v1 } }, { p3, color, { u0, v1 } },
+    };
+    auto& vertices = batchFor(texture).vertices;
+    vertices.insert(vertices.end(), quad, quad + 6);
+}
+
+void SpriteBatch::add(const sf::Sprite& sprite) {
+    add(sprite.getTexture(), sprite.getTextureRect(), sprite.getPosition(), sprite.getRotation().asDegrees(),
+        sprite.getScale(), sprite.getOrigin(), sprite.getColor());
+}
+
+void SpriteBatch::flush(Window& window) {
+    for (std::size_t i = 0; i < m_used; ++i) {
+        const Batch& batch = m_batches[i];
+        sf::RenderStates states;
+        states.texture = batch.texture;
+        window.draw(batch.vertices.data(), batch.vertices.size(), sf::PrimitiveType::Triangles, states);
+    }
+    recordStats();
+}
+
+void SpriteBatch::submit(RenderQueue& queue, RenderLayer layer, float depth) {
+    for (std::size_t i = 0; i < m_used; ++i) {
+        const Batch& batch = m_batches[i];
+        queue.submit(layer, depth, batch.vertices.data(), batch.vertices.size(),
+            sf::PrimitiveType::Triangles, batch.texture);
+    }
+    recordStats();
+}
+
+void SpriteBatch::recordStats() {
+    m_stats.sprites = m_sprites;
+    m_stats.culled = m_culled;
+    m_stats.batches = m_used;
+}
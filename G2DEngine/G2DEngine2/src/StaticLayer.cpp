@@ -0,0 +1,116 @@
+#include "StaticLayer.h"
+#include "DebugGeometry.h"
+#include "Window.h"
+#include "ECS/Actor.h"
+
+#include <SFML/Graphics/Sprite.hpp>
+
+namespace {
+
+    std::uint32_t transformVersion(const Actor& actor) {
+        auto xf = actor.getComponentPtr<Transform>();
+        return xf ? xf->getVersion() : 0u;
+    }
+
+    std::uint32_t shapeVersion(const Actor& actor) {
+        auto shape = actor.getComponentPtr<CShape>();
+        return shape ? shape->getVersion() : 0u;
+    }
+
+} // namespace
+
+void StaticLayer::addActor(const EngineUtilities::TSharedPointer<Actor>& actor) {
+    if (actor.isNull()) return;
+    m_actors.push_back({ actor, 0u, 0u });
+    m_dirty = true;
+}
+
+void StaticLayer::addGeometry(const DebugGeometry& geometry) {
+    m_geometry.push_back({ &geometry, 0u });
+    m_dirty = true;
+}
+
+void StaticLayer::clear() {
+    m_actors.clear();
+    m_geometry.clear();
+    m_dirty = true;
+}
+
+bool StaticLayer::isStale(const sf::View& view, sf::Vector2u size) const {
+    if (m_dirty || m_texture.getSize() != size) return true;
+    if (view.getCenter() != m_bakedCenter || view.getSize() != m_bakedSize) return true;
+    for (const auto& e : m_actors) {
+        if (transformVersion(*e.actor) != e.transformVersion || shapeVersion(*e.actor) != e.shapeVersion) return true;
+    }
+    for (const auto& g : m_geometry) {
+        if (g.geometry->getRebuildCount() != g.changes) return true;
+    }
+    return false;
+}
+
+void StaticLayer::bake(const sf::View& view, sf::Vector2u size) {
+    if (m_texture.getSize() != size && !m_texture.resize(size)) {
+        m_unavailable = true;
+        return;
+    }
+
+    // Misma vista que la ventana: la textura cubre exactamente lo que se ve
+    m_texture.setView(view);
+    m_texture.clear(sf::Color::Transparent);
+    for (auto& e : m_actors) {
+        e.actor->renderTo(m_texture);
+        e.transformVersion = transformVersion(*e.actor);
+        e.shapeVersion = shapeVersion(*e.actor);
+    }
+    for (auto& g : m_geometry) {
+        g.geometry->drawTo(m_texture);
+        g.changes = g.geometry->getRebuildCount();
+    }
+    m_texture.display();
+
+    m_bakedCenter = view.getCenter();
+    m_bakedSize = view.getSize();
+    m_dirty = false;
+    ++m_bakes;
+}
+
+void StaticLayer::renderDirect(const EngineUtilities::TSharedPointer<Window>& window) {
+    for (auto& e : m_actors) e.actor->render(window);
+    for (auto& g : m_geometry) g.geometry->draw(*window);
+}
+
+bool StaticLayer::prepare(Window& window) {
+    if (m_unavailable) return false;
+
+    auto& target = window.getInternal();
+    const sf::View& view = target.getView();
+    const sf::Vector2u size = target.getSize();
+    if (size.x == 0 || size.y == 0) return false;
+    if (isStale(view, size)) bake(view, size);
+    if (m_unavailable) return false;
+
+    // La textura tiene píxeles de ventana; se estira a la vista para caer en el mismo sitio
+    if (!m_blit) m_blit.emplace(m_texture.getTexture());
+    m_blit->setTextureRect(sf::IntRect({ 0, 0 }, sf::Vector2i(size)));
+    m_blit->setPosition(view.getCenter() - view.getSize() * 0.5f);
+    m_blit->setScale({ view.getSize().x / float(size.x), view.getSize().y / float(size.y) });
+    return true;
+}
+
+void StaticLayer::render(const EngineUtilities::TSharedPointer<Window>& window) {
+    if (window.isNull()) return;
+    if (prepare(*window)) window->draw(*m_blit);
+    else if (m_unavailable) renderDirect(window);
+}
+
+void StaticLayer::submitDirect(RenderQueue& queue, RenderLayer layer, float depth) {
+    // Los actores van en su propia capa; la geometría, un nivel por encima para no quedar debajo
+    // de los actores aunque la capa agrupe por textura (RenderSort::Texture)
+    for (auto& e : m_actors) e.actor->submit(queue);
+    for (auto& g : m_geometry) g.geometry->submit(queue, layer, depth + 1.f);
+}
+
+void StaticLayer::submit(RenderQueue& queue, Window& window, RenderLayer layer, float depth) {
+    if (prepare(window)) queue.submit(layer, depth, *m_blit);
+    else if (m_unavailable) submitDirect(queue, layer, depth);
+}
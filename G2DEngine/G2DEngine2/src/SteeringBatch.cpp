@@ -0,0 +1,253 @@
+#include "SteeringBatch.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define G2D_STEERING_SSE2 1
+#include <emmintrin.h>
+#endif
+
+bool SteeringBatch::steerOne(const sf::Vector2f* path, int pathSize, int& waypoint,
+    sf::Vector2f& pos, float& rotationDeg, const Params& params, float dt) {
+    // Segmento actual A->B
+    const int N = pathSize;
+    int i = waypoint;
+    sf::Vector2f A = path[i];
+    sf::Vector2f B = path[(i + 1) % N];
+    sf::Vector2f AB = B - A;
+    float abLen2 = AB.x * AB.x + AB.y * AB.y;
+    if (abLen2 < 1e-6f) { waypoint = (i + 1) % N; return false; }
+    float abLen = std::sqrt(abLen2);
+
+    // Proyección del coche sobre el segmento A->B
+    sf::Vector2f AP = pos - A;
+    float t = (AP.x * AB.x + AP.y * AB.y) / abLen2; // 0..1 si estás dentro del segmento
+
+    // Regla de avance de waypoint:
+    // - Si ya pasaste B (t > 1), o
+    // - Si estás suficientemente cerca de B,
+    //   avanza al siguiente
+    float distToB = std::hypot(pos.x - B.x, pos.y - B.y);
+    if (t > 1.f || distToB < params.arriveRadius) {
+        waypoint = (i + 1) % N;
+        i = waypoint;
+        A = path[i];
+        B = path[(i + 1) % N];
+        AB = B - A;
+        abLen2 = AB.x * AB.x + AB.y * AB.y;
+        abLen = std::sqrt(abLen2);
+        if (abLen2 < 1e-6f) return false;
+        AP = pos - A;
+        t = (AP.x * AB.x + AP.y * AB.y) / abLen2;
+    }
+
+    // Punto de persecución (pure pursuit) a partir de la proyección + lookahead
+    float s = std::clamp(t + (params.lookahead / std::max(abLen, 1e-3f)), 0.f, 1.f);
+    sf::Vector2f pursue = A + AB * s;
+
+    // Velocidad con frenado suave al aproximarse al punto de persecución
+    sf::Vector2f to = pursue - pos;
+    float d = std::hypot(to.x, to.y);
+    if (d <= 1e-4f) return false;
+
+    sf::Vector2f dir = { to.x / d, to.y / d };
+
+    float brakeRadius = params.lookahead * 1.2f;
+    float speed = (d < brakeRadius) ? (params.maxSpeed * (d / brakeRadius)) : params.maxSpeed;
+
+    pos += dir * speed * dt;
+    rotationDeg = std::atan2(dir.y, dir.x) * 180.f / 3.14159265f;
+    return true;
+}
+
+bool SteeringBatch::hasSimd() {
+#ifdef G2D_STEERING_SSE2
+    return true;
+#else
+    return false;
+#endif
+}
+
+void SteeringBatch::clear() {
+    m_posX.clear(); m_posY.clear(); m_rotation.clear();
+    m_waypoint.clear(); m_pathSize.clear(); m_path.clear();
+    m_maxSpeed.clear(); m_lookahead.clear(); m_arriveRadius.clear();
+    m_moved.clear();
+}
+
+void SteeringBatch::reserve(std::size_t count) {
+    m_posX.reserve(count); m_posY.reserve(count); m_rotation.reserve(count);
+    m_waypoint.reserve(count); m_pathSize.reserve(count); m_path.reserve(count);
+    m_maxSpeed.reserve(count); m_lookahead.reserve(count); m_arriveRadius.reserve(count);
+    m_moved.reserve(count);
+}
+
+std::size_t SteeringBatch::add(const sf::Vector2f* path, int pathSize, int waypoint,
+    const sf::Vector2f& pos, float rotationDeg, const Params& params) {
+    m_posX.push_back(pos.x);
+    m_posY.push_back(pos.y);
+    m_rotation.push_back(rotationDeg);
+    m_waypoint.push_back(waypoint);
+    m_pathSize.push_back(pathSize);
+    m_path.push_back(path);
+    m_maxSpeed.push_back(params.maxSpeed);
+    m_lookahead.push_back(params.lookahead);
+    m_arriveRadius.push_back(params.arriveRadius);
+    m_moved.push_back(0);
+    return m_posX.size() - 1;
+}
+
+void SteeringBatch::stepRange(std::size_t begin, std::size_t end, float dt) {
+    for (std::size_t k = begin; k < end; ++k) {
+        sf::Vector2f pos{ m_posX[k], m_posY[k] };
+        int wp = m_waypoint[k];
+        const Params params{ m_maxSpeed[k], m_lookahead[k], m_arriveRadius[k] };
+
+        const bool moved = steerOne(m_path[k], m_pathSize[k], wp, pos, m_rotation[k], params, dt);
+        m_posX[k] = pos.x;
+        m_posY[k] = pos.y;
+        m_waypoint[k] = wp;
+        m_moved[k] = moved ? 1 : 0;
+    }
+}
+
+void SteeringBatch::stepScalar(float dt) {
+    stepRange(0, size(), dt);
+}
+
+#ifdef G2D_STEERING_SSE2
+namespace { // ------- helpers SSE2 -------
+
+    inline __m128 select(__m128 mask, __m128 a, __m128 b) {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    /**
+     * atan2 en 4 carriles: reducción al octante [0, 1] y el polinomio de
+     * Abramowitz & Stegun 4.4.49 (|error| <= 1e-5 rad).
+     */
+    inline __m128 atan2Ps(__m128 y, __m128 x) {
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+        const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(int(0x80000000u)));
+        const __m128 ax = _mm_and_ps(x, absMask);
+        const __m128 ay = _mm_and_ps(y, absMask);
+        const __m128 hi = _mm_max_ps(ax, ay);
+        const __m128 lo = _mm_min_ps(ax, ay);
+        const __m128 a = _mm_div_ps(lo, _mm_max_ps(hi, _mm_set1_ps(1e-30f)));
+        const __m128 s = _mm_mul_ps(a, a);
+
+        __m128 r = _mm_set1_ps(0.0208351f);
+        r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(-0.0851330f));
+        r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(0.1801410f));
+        r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(-0.3302995f));
+        r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(0.9998660f));
+        r = _mm_mul_ps(r, a);
+
+        r = select(_mm_cmpgt_ps(ay, ax), _mm_sub_ps(_mm_set1_ps(1.57079633f), r), r);
+        r = select(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(3.14159265f), r), r);
+        return _mm_or_ps(r, _mm_and_ps(y, signMask));
+    }
+
+    inline __m128 length(__m128 x, __m128 y) {
+        return _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+    }
+
+} // namespace
+#endif
+
+void SteeringBatch::stepSimd(float dt) {
+#ifdef G2D_STEERING_SSE2
+    const std::size_t n = size();
+    const std::size_t blocks = n / 4 * 4;
+
+    const __m128 eps2 = _mm_set1_ps(1e-6f);
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 vdt = _mm_set1_ps(dt);
+
+    for (std::size_t k = 0; k < blocks; k += 4) {
+        // Gather: puntos A, B y C (el segmento siguiente) de cada carril
+        alignas(16) float ax[4], ay[4], bx[4], by[4], cx[4], cy[4];
+        for (int l = 0; l < 4; ++l) {
+            const sf::Vector2f* path = m_path[k + l];
+            const int N = m_pathSize[k + l];
+            const int i = m_waypoint[k + l];
+            ax[l] = path[i].x;           ay[l] = path[i].y;
+            bx[l] = path[(i + 1) % N].x; by[l] = path[(i + 1) % N].y;
+            cx[l] = path[(i + 2) % N].x; cy[l] = path[(i + 2) % N].y;
+        }
+        const __m128 Ax = _mm_load_ps(ax), Ay = _mm_load_ps(ay);
+        const __m128 Bx = _mm_load_ps(bx), By = _mm_load_ps(by);
+        const __m128 Cx = _mm_load_ps(cx), Cy = _mm_load_ps(cy);
+
+        const __m128 px = _mm_loadu_ps(&m_posX[k]);
+        const __m128 py = _mm_loadu_ps(&m_posY[k]);
+        const __m128 rot = _mm_loadu_ps(&m_rotation[k]);
+        const __m128 maxSpeed = _mm_loadu_ps(&m_maxSpeed[k]);
+        const __m128 look = _mm_loadu_ps(&m_lookahead[k]);
+        const __m128 arrive = _mm_loadu_ps(&m_arriveRadius[k]);
+
+        // Segmento actual A->B y proyección
+        const __m128 ABx = _mm_sub_ps(Bx, Ax), ABy = _mm_sub_ps(By, Ay);
+        const __m128 abLen2 = _mm_add_ps(_mm_mul_ps(ABx, ABx), _mm_mul_ps(ABy, ABy));
+        const __m128 degenAB = _mm_cmplt_ps(abLen2, eps2);
+        const __m128 abLen = _mm_sqrt_ps(abLen2);
+        const __m128 tAB = _mm_div_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_sub_ps(px, Ax), ABx), _mm_mul_ps(_mm_sub_ps(py, Ay), ABy)), abLen2);
+        const __m128 distToB = length(_mm_sub_ps(px, Bx), _mm_sub_ps(py, By));
+
+        // Avance de waypoint (los carriles con A->B degenerado ya avanzan y no se mueven)
+        const __m128 advance = _mm_andnot_ps(degenAB,
+            _mm_or_ps(_mm_cmpgt_ps(tAB, one), _mm_cmplt_ps(distToB, arrive)));
+
+        // Segmento siguiente B->C, usado por los carriles que avanzan
+        const __m128 BCx = _mm_sub_ps(Cx, Bx), BCy = _mm_sub_ps(Cy, By);
+        const __m128 bcLen2 = _mm_add_ps(_mm_mul_ps(BCx, BCx), _mm_mul_ps(BCy, BCy));
+        const __m128 degenBC = _mm_and_ps(advance, _mm_cmplt_ps(bcLen2, eps2));
+        const __m128 bcLen = _mm_sqrt_ps(bcLen2);
+        const __m128 tBC = _mm_div_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_sub_ps(px, Bx), BCx), _mm_mul_ps(_mm_sub_ps(py, By), BCy)), bcLen2);
+
+        const __m128 Sx = select(advance, Bx, Ax), Sy = select(advance, By, Ay);
+        const __m128 Dx = select(advance, BCx, ABx), Dy = select(advance, BCy, ABy);
+        const __m128 segLen = select(advance, bcLen, abLen);
+        const __m128 t = select(advance, tBC, tAB);
+
+        // Punto de persecución y dirección
+        __m128 s = _mm_add_ps(t, _mm_div_ps(look, _mm_max_ps(segLen, _mm_set1_ps(1e-3f))));
+        s = _mm_min_ps(_mm_max_ps(s, zero), one);
+        const __m128 toX = _mm_sub_ps(_mm_add_ps(Sx, _mm_mul_ps(Dx, s)), px);
+        const __m128 toY = _mm_sub_ps(_mm_add_ps(Sy, _mm_mul_ps(Dy, s)), py);
+        const __m128 d = length(toX, toY);
+
+        const __m128 move = _mm_andnot_ps(_mm_or_ps(degenAB, degenBC),
+            _mm_cmpgt_ps(d, _mm_set1_ps(1e-4f)));
+
+        const __m128 dirX = _mm_div_ps(toX, d), dirY = _mm_div_ps(toY, d);
+        const __m128 brake = _mm_mul_ps(look, _mm_set1_ps(1.2f));
+        const __m128 speed = select(_mm_cmplt_ps(d, brake),
+            _mm_mul_ps(maxSpeed, _mm_div_ps(d, brake)), maxSpeed);
+
+        const __m128 nx = _mm_add_ps(px, _mm_mul_ps(_mm_mul_ps(dirX, speed), vdt));
+        const __m128 ny = _mm_add_ps(py, _mm_mul_ps(_mm_mul_ps(dirY, speed), vdt));
+        const __m128 angle = _mm_div_ps(_mm_mul_ps(atan2Ps(dirY, dirX), _mm_set1_ps(180.f)),
+            _mm_set1_ps(3.14159265f));
+
+        _mm_storeu_ps(&m_posX[k], select(move, nx, px));
+        _mm_storeu_ps(&m_posY[k], select(move, ny, py));
+        _mm_storeu_ps(&m_rotation[k], select(move, angle, rot));
+
+        const int moveBits = _mm_movemask_ps(move);
+        const int advanceBits = _mm_movemask_ps(_mm_or_ps(degenAB, advance));
+        for (int l = 0; l < 4; ++l) {
+            if (advanceBits & (1 << l)) m_waypoint[k + l] = (m_waypoint[k + l] + 1) % m_pathSize[k + l];
+            m_moved[k + l] = (moveBits >> l) & 1;
+        }
+    }
+
+    stepRange(blocks, n, dt);
+#else
+    stepScalar(dt);
+#endif
+}
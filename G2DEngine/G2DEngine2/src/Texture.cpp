@@ -1,4 +1,5 @@
 ﻿#include "ECS/Texture.h"
+#include "SpriteBatch.h"
 #include "Window.h"
 #include <iostream>
 
@@ -21,6 +22,8 @@ Texture::Texture(const std::string& textureName, const std::string& extension)
         return;
     }
 
+    m_rect = sf::IntRect({ 0, 0 }, sf::Vector2i(m_texture.getSize()));
+
     // 2) Crea el sprite y le asigna la textura cargada.
     //    Usamos el ctor que recibe la textura (SFML 3) para evitar temporales.
     m_sprite.emplace(m_texture); // ¡l-value, no temporales!
@@ -31,6 +34,18 @@ Texture::Texture(const std::string& textureName, const std::string& extension)
     m_sprite->setOrigin(sf::Vector2f{ sz.x * 0.5f, sz.y * 0.5f });
 }
 
+// Sprite de atlas: comparte la página y solo muestra su rectángulo.
+Texture::Texture(const std::string& textureName, const EngineUtilities::TSharedPointer<sf::Texture>& atlasPage,
+    const sf::IntRect& rect)
+    : m_page(atlasPage), m_rect(rect), m_name(textureName) {
+    if (m_page.isNull()) {
+        std::cerr << "[Texture] Missing atlas page for: " << m_name << "\n";
+        return;
+    }
+    m_sprite.emplace(*m_page, m_rect);
+    m_sprite->setOrigin(sf::Vector2f{ rect.size.x * 0.5f, rect.size.y * 0.5f });
+}
+
 // Cambia la posición en coordenadas de mundo.
 void Texture::setPosition(const sf::Vector2f& p) {
     if (m_sprite) m_sprite->setPosition(p);
@@ -50,4 +65,19 @@ void Texture::setScale(const sf::Vector2f& s) {
 void Texture::render(const EngineUtilities::TSharedPointer<Window>& window) {
     if (!m_sprite) return;
     window->draw(*m_sprite);
+}
+
+// Igual que render(), pero sobre cualquier RenderTarget.
+void Texture::renderTo(sf::RenderTarget& target) const {
+    if (m_sprite) target.draw(*m_sprite);
+}
+
+// Encola el sprite; Window::flush() lo dibuja en orden de capa y profundidad.
+void Texture::submit(RenderQueue& queue, RenderLayer layer, float depth) const {
+    if (m_sprite) queue.submit(layer, depth, *m_sprite);
+}
+
+// Igual que render(), pero el sprite se acumula en el lote de su textura.
+void Texture::addToBatch(SpriteBatch& batch) const {
+    if (m_sprite) batch.add(*m_sprite);
 }
\ No newline at end of file
@@ -0,0 +1,237 @@
+#include "TextureAtlas.h"
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+// ImGui compila su propia copia con STBRP_STATIC; esta también queda interna a la unidad
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include <imstb_rectpack.h>
+
+namespace {
+
+    constexpr const char* kLayoutMagic = "G2DATLAS";
+    constexpr int kLayoutVersion = 1;
+
+    std::string sourcePath(const std::string& name, const std::string& extension) {
+        return std::string("bin/") + name + "." + extension;
+    }
+
+    std::string pagePath(const std::string& cacheDir, std::size_t page) {
+        return cacheDir + "/atlas_" + std::to_string(page) + ".png";
+    }
+
+} // namespace
+
+TextureAtlas::Layout TextureAtlas::pack(const std::vector<sf::Vector2i>& sizes, int maxPageSize, int padding) {
+    Layout layout;
+    layout.pages.assign(sizes.size(), -1);
+    layout.positions.assign(sizes.size(), { 0, 0 });
+
+    // Cada rectángulo reserva su padding a la derecha y abajo; el de arriba/izquierda lo pone el
+    // borde de la página, que se reduce en padding px
+    const int usable = maxPageSize - padding;
+    std::vector<stbrp_rect> pending;
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        const int w = sizes[i].x + padding, h = sizes[i].y + padding;
+        if (sizes[i].x <= 0 || sizes[i].y <= 0 || w > usable || h > usable) continue;
+        stbrp_rect r{};
+        r.id = int(i);
+        r.w = w;
+        r.h = h;
+        pending.push_back(r);
+    }
+
+    // Una página por vuelta: lo que no cupo pasa a la siguiente
+    std::vector<stbrp_node> nodes(std::size_t(std::max(usable, 1)));
+    while (!pending.empty()) {
+        stbrp_context context;
+        stbrp_init_target(&context, usable, usable, nodes.data(), int(nodes.size()));
+        stbrp_pack_rects(&context, pending.data(), int(pending.size()));
+
+        const int page = int(layout.pageSizes.size());
+        sf::Vector2i extent{ 0, 0 };
+        std::vector<stbrp_rect> rest;
+        for (const stbrp_rect& r : pending) {
+            if (!r.was_packed) {
+                rest.push_back(r);
+                continue;
+            }
+            layout.pages[std::size_t(r.id)] = page;
+            layout.positions[std::size_t(r.id)] = { r.x + padding, r.y + padding };
+            extent.x = std::max(extent.x, r.x + r.w + padding);
+            extent.y = std::max(extent.y, r.y + r.h + padding);
+        }
+        if (rest.size() == pending.size()) break; // no debería pasar: todos caben en una página vacía
+        layout.pageSizes.push_back(extent);
+        pending.swap(rest);
+    }
+    return layout;
+}
+
+bool TextureAtlas::build(const std::vector<std::string>& fileNames, const std::string& extension,
+    const std::string& cacheDir) {
+    clear();
+
+    // Entradas en el orden pedido; las que no existan en disco se quedan sin página
+    std::vector<SourceStamp> stamps;
+    for (const std::string& name : fileNames) {
+        if (m_index.count(name)) continue;
+        m_index[name] = m_entries.size();
+        m_entries.push_back({ name, -1, {} });
+
+        const std::string path = sourcePath(name, extension);
+        std::error_code ec;
+        const std::uintmax_t bytes = std::filesystem::file_size(path, ec);
+        if (ec) {
+            std::cerr << "[TextureAtlas] Cannot find: " << path << "\n";
+            continue;
+        }
+        const auto modified = std::filesystem::last_write_time(path, ec);
+        stamps.push_back({ name, bytes, ec ? 0 : std::int64_t(modified.time_since_epoch().count()) });
+    }
+
+    if (!cacheDir.empty() && loadCache(cacheDir, stamps)) {
+        m_fromCache = true;
+        return true;
+    }
+
+    // Sin caché válida: decodifica, empaqueta y compone las páginas
+    std::vector<sf::Image> images(stamps.size());
+    std::vector<sf::Vector2i> sizes(stamps.size(), { 0, 0 });
+    for (std::size_t i = 0; i < stamps.size(); ++i) {
+        const std::string path = sourcePath(stamps[i].name, extension);
+        if (!images[i].loadFromFile(path)) {
+            std::cerr << "[TextureAtlas] Cannot load: " << path << "\n";
+            continue;
+        }
+        const sf::Vector2i size{ int(images[i].getSize().x), int(images[i].getSize().y) };
+        m_entries[m_index[stamps[i].name]].rect = { { 0, 0 }, size };
+        if (size.x <= m_options.maxSpriteSize && size.y <= m_options.maxSpriteSize) sizes[i] = size;
+    }
+
+    const Layout layout = pack(sizes, m_options.maxPageSize, m_options.padding);
+    std::vector<sf::Image> pageImages;
+    for (const sf::Vector2i& size : layout.pageSizes) {
+        pageImages.emplace_back(sf::Vector2u(size), sf::Color::Transparent);
+    }
+    for (std::size_t i = 0; i < stamps.size(); ++i) {
+        const int page = layout.pages[i];
+        if (page < 0) continue;
+        Entry& entry = m_entries[m_index[stamps[i].name]];
+        if (!pageImages[std::size_t(page)].copy(images[i], sf::Vector2u(layout.positions[i]))) {
+            std::cerr << "[TextureAtlas] Cannot copy " << entry.name << " to page " << page << "\n";
+            continue;
+        }
+        entry.page = page;
+        entry.rect.position = layout.positions[i];
+    }
+
+    for (const sf::Image& image : pageImages) {
+        auto texture = EngineUtilities::MakeShared<sf::Texture>();
+        if (!texture->loadFromImage(image)) {
+            std::cerr << "[TextureAtlas] Cannot create page texture " << m_pages.size() << "\n";
+        }
+        m_pages.push_back(texture);
+    }
+
+    if (!cacheDir.empty() && !saveCache(cacheDir, stamps, pageImages)) {
+        std::cerr << "[TextureAtlas] Cannot write cache: " << cacheDir << "\n";
+    }
+    return !m_pages.empty();
+}
+
+const TextureAtlas::Entry* TextureAtlas::find(const std::string& name) const {
+    auto it = m_index.find(name);
+    return it != m_index.end() ? &m_entries[it->second] : nullptr;
+}
+
+EngineUtilities::TSharedPointer<sf::Texture> TextureAtlas::getPage(int index) const {
+    if (index < 0 || std::size_t(index) >= m_pages.size()) return EngineUtilities::TSharedPointer<sf::Texture>();
+    return m_pages[std::size_t(index)];
+}
+
+void TextureAtlas::clear() {
+    m_entries.clear();
+    m_index.clear();
+    m_pages.clear();
+    m_fromCache = false;
+}
+
+// Formato de atlas.layout (texto):
+//   G2DATLAS 1
+//   options <maxPageSize> <padding> <maxSpriteSize>
+//   pages <N>
+//   sprites <M>
+//   <bytes> <modified> <page> <x> <y> <w> <h> <name>      (M líneas, en el orden de build())
+bool TextureAtlas::loadCache(const std::string& cacheDir, const std::vector<SourceStamp>& stamps) {
+    std::ifstream f(cacheDir + "/atlas.layout");
+    if (!f) return false;
+
+    std::string magic, key;
+    int version = 0;
+    Options options;
+    std::size_t pageCount = 0, spriteCount = 0;
+    f >> magic >> version;
+    f >> key >> options.maxPageSize >> options.padding >> options.maxSpriteSize;
+    if (!f || magic != kLayoutMagic || version != kLayoutVersion || key != "options") return false;
+    if (options.maxPageSize != m_options.maxPageSize || options.padding != m_options.padding ||
+        options.maxSpriteSize != m_options.maxSpriteSize) return false;
+    f >> key >> pageCount;
+    if (!f || key != "pages") return false;
+    f >> key >> spriteCount;
+    if (!f || key != "sprites" || spriteCount != stamps.size()) return false;
+
+    // Se valida todo antes de tocar el atlas: si algo no cuadra se reconstruye desde cero
+    std::vector<Entry> cached(spriteCount);
+    for (std::size_t i = 0; i < spriteCount; ++i) {
+        SourceStamp stamp;
+        Entry& entry = cached[i];
+        f >> stamp.bytes >> stamp.modified >> entry.page
+            >> entry.rect.position.x >> entry.rect.position.y >> entry.rect.size.x >> entry.rect.size.y;
+        std::getline(f >> std::ws, stamp.name);
+        if (!f || stamp.name != stamps[i].name || stamp.bytes != stamps[i].bytes ||
+            stamp.modified != stamps[i].modified || entry.page >= int(pageCount)) return false;
+        entry.name = stamp.name;
+    }
+
+    std::vector<EngineUtilities::TSharedPointer<sf::Texture>> pages;
+    for (std::size_t p = 0; p < pageCount; ++p) {
+        auto texture = EngineUtilities::MakeShared<sf::Texture>();
+        if (!texture->loadFromFile(pagePath(cacheDir, p))) return false;
+        pages.push_back(texture);
+    }
+
+    for (const Entry& entry : cached) m_entries[m_index[entry.name]] = entry;
+    m_pages = std::move(pages);
+    return !m_pages.empty();
+}
+
+bool TextureAtlas::saveCache(const std::string& cacheDir, const std::vector<SourceStamp>& stamps,
+    const std::vector<sf::Image>& pageImages) const {
+    std::error_code ec;
+    std::filesystem::create_directories(cacheDir, ec);
+    if (ec) return false;
+
+    for (std::size_t p = 0; p < pageImages.size(); ++p) {
+        if (!pageImages[p].saveToFile(pagePath(cacheDir, p))) return false;
+    }
+
+    std::ofstream f(cacheDir + "/atlas.layout");
+    if (!f) return false;
+    f << kLayoutMagic << ' ' << kLayoutVersion << '\n';
+    f << "options " << m_options.maxPageSize << ' ' << m_options.padding << ' ' << m_options.maxSpriteSize << '\n';
+    f << "pages " << pageImages.size() << '\n';
+    f << "sprites " << stamps.size() << '\n';
+    for (const SourceStamp& stamp : stamps) {
+        const Entry& entry = m_entries[m_index.at(stamp.name)];
+        f << stamp.bytes << ' ' << stamp.modified << ' ' << entry.page << ' '
+            << entry.rect.position.x << ' ' << entry.rect.position.y << ' '
+            << entry.rect.size.x << ' ' << entry.rect.size.y << ' ' << stamp.name << '\n';
+    }
+    return bool(f);
+}
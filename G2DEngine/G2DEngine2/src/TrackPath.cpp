@@ -0,0 +1,143 @@
+#include "TrackPath.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace { // ------- helpers de geometría -------
+
+    inline float vlen(const sf::Vector2f& v) { return std::sqrt(v.x * v.x + v.y * v.y); }
+    inline sf::Vector2f vnorm(const sf::Vector2f& v) {
+        float L = vlen(v); return (L > 1e-6f) ? sf::Vector2f{ v.x / L, v.y / L } : sf::Vector2f{ 0.f,0.f };
+    }
+    inline sf::Vector2f vperp(const sf::Vector2f& v) { return sf::Vector2f{ -v.y, v.x }; }
+
+} // namespace
+
+TrackPath::TrackPath(std::vector<sf::Vector2f> points)
+    : m_points(std::move(points)) {
+    const int N = size();
+    if (N < 2) return;
+
+    m_cumulative.reserve(N + 1);
+    m_cumulative.push_back(0.f);
+    for (int i = 0; i < N; ++i) {
+        const sf::Vector2f d = m_points[(i + 1) % N] - m_points[i];
+        m_cumulative.push_back(m_cumulative.back() + vlen(d));
+    }
+}
+
+TrackPath::Ptr TrackPath::create(std::vector<sf::Vector2f> points) {
+    return EngineUtilities::MakeShared<TrackPath>(std::move(points));
+}
+
+const TrackPath& TrackPath::emptyPath() {
+    static const TrackPath s_empty;
+    return s_empty;
+}
+
+const TrackPath& TrackPath::lane(float offsetPx) const {
+    if (std::abs(offsetPx) < 1e-6f) return *this;
+
+    // Cada carril vive en su propio bloque: la referencia sigue valiendo aunque m_lanes crezca
+    std::lock_guard<std::mutex> lock(m_lanesMutex);
+    for (const auto& l : m_lanes) {
+        if (l.offset == offsetPx) return *l.path;
+    }
+    m_lanes.push_back(Lane{ offsetPx, EngineUtilities::MakeShared<TrackPath>(offsetPoints(m_points, offsetPx)) });
+    return *m_lanes.back().path;
+}
+
+std::vector<sf::Vector2f> TrackPath::offsetPoints(const std::vector<sf::Vector2f>& path, float offsetPx) {
+    const int N = (int)path.size();
+    if (N < 2 || std::abs(offsetPx) < 1e-6f) return path;
+    std::vector<sf::Vector2f> res(N);
+    for (int i = 0; i < N; ++i) {
+        const sf::Vector2f Pm = path[(i - 1 + N) % N];
+        const sf::Vector2f P = path[i];
+        const sf::Vector2f Pp = path[(i + 1) % N];
+
+        sf::Vector2f t1 = vnorm(P - Pm);
+        sf::Vector2f t2 = vnorm(Pp - P);
+        sf::Vector2f t = vnorm(t1 + t2);
+        if (t.x == 0.f && t.y == 0.f) t = t1;
+
+        sf::Vector2f nrm = vnorm(vperp(t));   // normal a la izquierda
+        res[i] = P + nrm * offsetPx;
+    }
+    return res;
+}
+
+float TrackPath::wrap(float distance) const {
+    const float total = totalLength();
+    if (total <= 0.f) return 0.f;
+    float d = std::fmod(distance, total);
+    if (d < 0.f) d += total;
+    return d < total ? d : 0.f;   // fmod puede devolver total por redondeo
+}
+
+int TrackPath::segmentAt(float distance) const {
+    if (m_cumulative.empty()) return 0;
+    const float d = wrap(distance);
+    // Primer inicio de segmento > d; el segmento es el anterior
+    const auto it = std::upper_bound(m_cumulative.begin(), m_cumulative.end() - 1, d);
+    return std::max(0, int(it - m_cumulative.begin()) - 1);
+}
+
+sf::Vector2f TrackPath::pointAt(float distance) const {
+    if (m_cumulative.empty()) return m_points.empty() ? sf::Vector2f{} : m_points.front();
+
+    const float d = wrap(distance);
+    const int i = segmentAt(d);
+    const float len = segmentLength(i);
+    const float t = len > 1e-6f ? (d - m_cumulative[i]) / len : 0.f;
+
+    const sf::Vector2f A = m_points[i];
+    const sf::Vector2f B = m_points[(i + 1) % size()];
+    return A + (B - A) * t;
+}
+
+float TrackPath::project(int segment, const sf::Vector2f& pos, float& dist2) const {
+    const sf::Vector2f A = m_points[segment];
+    const sf::Vector2f AB = m_points[(segment + 1) % size()] - A;
+    const float abLen2 = AB.x * AB.x + AB.y * AB.y;
+
+    const sf::Vector2f AP = pos - A;
+    const float t = abLen2 > 1e-6f
+        ? std::clamp((AP.x * AB.x + AP.y * AB.y) / abLen2, 0.f, 1.f)
+        : 0.f;
+
+    const sf::Vector2f Q = AP - AB * t;
+    dist2 = Q.x * Q.x + Q.y * Q.y;
+    return t;
+}
+
+float TrackPath::distanceAlong(const sf::Vector2f& pos, int hintSegment, int* outSegment) const {
+    const int N = size();
+    if (N < 2) {
+        if (outSegment) *outSegment = 0;
+        return 0.f;
+    }
+
+    int first = 0, count = N;
+    if (hintSegment >= 0 && 2 * kHintWindow + 1 < N) {
+        first = hintSegment % N - kHintWindow + N;
+        count = 2 * kHintWindow + 1;
+    }
+
+    int best = 0;
+    float bestT = 0.f, bestDist2 = 0.f;
+    for (int k = 0; k < count; ++k) {
+        const int segment = (first + k) % N;
+        float dist2;
+        const float t = project(segment, pos, dist2);
+        if (k == 0 || dist2 < bestDist2) {
+            best = segment;
+            bestT = t;
+            bestDist2 = dist2;
+        }
+    }
+
+    if (outSegment) *outSegment = best;
+    const float d = m_cumulative[best] + segmentLength(best) * bestT;
+    return d < totalLength() ? d : 0.f;   // el final del último segmento es el inicio de la ruta
+}
@@ -25,22 +25,6 @@ Window::~Window() {
     destroy();
 }
 
-// Bucle de eventos: despacha a callback y maneja cierre de ventana
-void Window::handleEvents(const std::function<void(const sf::Event&)>& callback) {
-    if (!m_windowPtr) return;
-
-    // En SFML 3, pollEvent() retorna std::optional<sf::Event>
-    while (auto event = m_windowPtr->pollEvent()) {
-        // Si hay callback del usuario, se invoca con el evento actual
-        if (callback) callback(*event);
-
-        // Cierre de ventana solicitado
-        if (event->is<sf::Event::Closed>()) {
-            close();
-        }
-    }
-}
-
 // La ventana sigue abierta?
 bool Window::isOpen() const {
     if (!m_windowPtr) return false;
@@ -56,13 +40,57 @@ void Window::clear(const sf::Color& color) {
 // Dibuja cualquier sf::Drawable con estados opcionales
 void Window::draw(const sf::Drawable& drawable, const sf::RenderStates& states) {
     if (!m_windowPtr) return;
+    ++m_frameStats.drawCalls;
     m_windowPtr->draw(drawable, states);
 }
 
+// Dibuja vrtices sueltos (sin sf::VertexArray, que reserva en el heap)
+void Window::draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+    const sf::RenderStates& states) {
+    if (!m_windowPtr || vertexCount == 0) return;
+    ++m_frameStats.drawCalls;
+    m_frameStats.vertices += vertexCount;
+    noteTexture(states.texture);
+    m_windowPtr->draw(vertices, vertexCount, type, states);
+}
+
+// Dibuja la cola ya ordenada: capa -> profundidad -> envo (o textura, si la capa lo pide).
+// Sin ventana solo se vaca la cola, sin tocar las estadsticas
+void Window::flush(RenderQueue& queue) {
+    if (!m_windowPtr) {
+        queue.clear();
+        return;
+    }
+    queue.sort();
+    m_frameStats.commands += queue.size();
+    for (const RenderCommand& c : queue.getCommands()) {
+        if (c.drawable) {
+            noteTexture(c.texture);
+            m_frameStats.vertices += c.vertexCount;
+            draw(*c.drawable);
+        }
+        else {
+            sf::RenderStates states;
+            states.texture = c.texture;
+            draw(c.vertices, c.vertexCount, c.primitive, states);
+        }
+    }
+    queue.clear();
+}
+
+void Window::noteTexture(const sf::Texture* texture) {
+    if (texture == m_boundTexture) return;
+    ++m_frameStats.textureSwitches;
+    m_boundTexture = texture;
+}
+
 // Presenta en pantalla el contenido del frame
 void Window::display() {
     if (!m_windowPtr) return;
     m_windowPtr->display();
+    m_lastFrameStats = m_frameStats;
+    m_frameStats = {};
+    m_boundTexture = nullptr;
 }
 
 // Actualiza deltaTime usando un reloj interno; llamar una vez por frame
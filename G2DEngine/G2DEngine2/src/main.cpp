@@ -1,8 +1,22 @@
 #include "BaseApp.h"
+#include "BatchRunner.h"
+#include "HeadlessRunner.h"
 #include <iostream>
 
-int main() {
+int main(int argc, char** argv) {
     try {
+        // --headless: solo simulación (sin ventana, texturas ni GUI)
+        if (HeadlessRunner::isRequested(argc, argv)) {
+            HeadlessRunner runner(HeadlessRunner::parseOptions(argc, argv));
+            return runner.run();
+        }
+
+        // --batch: miles de carreras con parámetros aleatorios en todos los núcleos
+        if (BatchRunner::isRequested(argc, argv)) {
+            BatchRunner runner(BatchRunner::parseOptions(argc, argv));
+            return runner.run();
+        }
+
         BaseApp app;
         int result = app.run();
         if (result != 0) {
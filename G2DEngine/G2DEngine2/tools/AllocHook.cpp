@@ -0,0 +1,59 @@
+#include "AllocHook.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+    std::atomic<AllocHook::Callback> g_callback{ nullptr };
+
+    inline void notify(std::size_t size) {
+        if (AllocHook::Callback callback = g_callback.load(std::memory_order_relaxed)) callback(size);
+    }
+
+    void* hookedAlloc(std::size_t size) {
+        notify(size);
+        if (void* p = std::malloc(size ? size : 1)) return p;
+        throw std::bad_alloc();
+    }
+
+    void* hookedAlignedAlloc(std::size_t size, std::align_val_t align) {
+        notify(size);
+        const std::size_t a = static_cast<std::size_t>(align);
+#if defined(_MSC_VER)
+        if (void* p = _aligned_malloc(size ? size : 1, a)) return p;
+#else
+        const std::size_t rounded = ((size ? size : 1) + a - 1) / a * a;
+        if (void* p = std::aligned_alloc(a, rounded)) return p;
+#endif
+        throw std::bad_alloc();
+    }
+
+    void alignedFree(void* p) noexcept {
+#if defined(_MSC_VER)
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+
+} // namespace
+
+void AllocHook::set(Callback callback) noexcept {
+    g_callback.store(callback, std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size) { return hookedAlloc(size); }
+void* operator new[](std::size_t size) { return hookedAlloc(size); }
+void* operator new(std::size_t size, std::align_val_t align) { return hookedAlignedAlloc(size, align); }
+void* operator new[](std::size_t size, std::align_val_t align) { return hookedAlignedAlloc(size, align); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { alignedFree(p); }
@@ -0,0 +1,24 @@
+#pragma once
+
+/**
+ * @file AllocHook.h
+ * @brief Reemplazo de operator new/delete globales con un callback por reserva.
+ *
+ * AllocHook.cpp reemplaza todas las variantes de operator new/delete (también las alineadas) por
+ * malloc/free y, antes de cada reserva, llama al callback instalado. Solo se enlaza en los
+ * ejecutables que cuentan reservas (G2DEngine2Bench y FrameAllocCheck), nunca en g2dengine.
+ */
+
+#include <cstddef>
+
+namespace AllocHook {
+
+    /**
+     * @brief Se llama en el hilo que reserva, antes de reservar. No debe reservar memoria de heap.
+     */
+    using Callback = void (*)(std::size_t size);
+
+    /** @brief Instala callback (nullptr lo quita). Se puede llamar desde cualquier hilo. */
+    void set(Callback callback) noexcept;
+
+} // namespace AllocHook
@@ -0,0 +1,20 @@
+#include "BatchRunner.h"
+#include <iostream>
+
+/**
+ * @file BatchMain.cpp
+ * @brief Entrada del binario de carreras en lote (G2DEngine2Batch).
+ *
+ * Acepta las mismas opciones que `G2DEngine2 --batch`: [--races N] [--laps N] [--threads N]
+ * [--seed N] [--dt S] [--max-time S] [--out FILE] [--format csv|bin] [--steering batched|per-racer].
+ */
+int main(int argc, char** argv) {
+    try {
+        BatchRunner runner(BatchRunner::parseOptions(argc, argv));
+        return runner.run();
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Unhandled exception: " << e.what() << '\n';
+        return -1;
+    }
+}
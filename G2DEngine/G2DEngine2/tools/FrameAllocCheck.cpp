@@ -0,0 +1,150 @@
+#include "AllocHook.h"
+#include "BaseApp.h"
+#include "Memory/AllocationTracker.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#if defined(__GLIBC__)
+#include <execinfo.h>
+#endif
+
+/**
+ * @file FrameAllocCheck.cpp
+ * @brief Verifica que el frame de BaseApp no reserve memoria de heap en régimen estable.
+ *
+ * Cuenta las reservas con el hook de AllocHook.cpp (que reemplaza operator new/delete), inicializa
+ * la aplicación, ejecuta unos frames de calentamiento (cachés de ImGui, fuentes, capacidad de
+ * vectores) y después N frames vigilados. Cada reserva
+ * en la fase vigilada se anota con la etiqueta de AllocationScope activa y su tamaño; con
+ * --stacks también se guarda la pila de llamadas (solo glibc). Sale con código 1 si hubo alguna.
+ *
+ * Uso: FrameAllocCheck [--warmup N] [--frames N] [--stacks]   (por defecto 120 y 1000 frames)
+ *
+ * Necesita una pantalla (abre la ventana real de la aplicación) y los recursos de bin/ en el
+ * directorio de trabajo; si falta alguno sale con kSkipCode, que CTest cuenta como omitido.
+ */
+
+namespace {
+
+    constexpr int kMaxRecords = 64;
+    constexpr int kMaxFrames = 24;
+    constexpr int kSkipCode = 77;   ///< SKIP_RETURN_CODE del test en CMakeLists.txt
+
+    struct Record {
+        const char* tag;
+        std::size_t size;
+        int frame;
+        int depth;
+        void* stack[kMaxFrames];
+    };
+
+    // Todo el estado es estático: el propio hook no puede reservar memoria
+    std::atomic<bool> g_watching{ false };
+    std::atomic<std::size_t> g_offenders{ 0 };
+    Record g_records[kMaxRecords];
+    int g_recordCount = 0;
+    int g_currentFrame = 0;
+    bool g_captureStacks = false;
+    thread_local bool t_inHook = false;
+
+    void recordAllocation(std::size_t size) {
+        if (!g_watching.load(std::memory_order_relaxed) || t_inHook) return;
+        t_inHook = true;
+
+        g_offenders.fetch_add(1, std::memory_order_relaxed);
+        if (g_recordCount < kMaxRecords) {
+            Record& r = g_records[g_recordCount++];
+            r.tag = EngineUtilities::AllocationTracker::currentTag();
+            r.size = size;
+            r.frame = g_currentFrame;
+            r.depth = 0;
+#if defined(__GLIBC__)
+            if (g_captureStacks) r.depth = backtrace(r.stack, kMaxFrames);
+#endif
+        }
+        t_inHook = false;
+    }
+
+    // Motivo para no poder ejecutar la comprobación aquí, o nullptr si se puede
+    const char* missingRequirement() {
+#if defined(__linux__)
+        if (!std::getenv("DISPLAY") && !std::getenv("WAYLAND_DISPLAY")) return "no display";
+#endif
+        if (!std::ifstream("bin/Sprites/Track.png")) return "bin/Sprites/Track.png not found";
+        return nullptr;
+    }
+
+    void printReport(int frames) {
+        const std::size_t total = g_offenders.load();
+        if (total == 0) {
+            std::printf("FrameAllocCheck: OK, 0 heap allocations in %d frames\n", frames);
+            return;
+        }
+
+        std::printf("FrameAllocCheck: FAIL, %zu heap allocations in %d frames\n", total, frames);
+        for (int i = 0; i < g_recordCount; ++i) {
+            const Record& r = g_records[i];
+            std::printf("  [frame %d] %zu bytes in %s\n", r.frame, r.size, r.tag ? r.tag : "(untagged)");
+#if defined(__GLIBC__)
+            if (r.depth > 0) {
+                backtrace_symbols_fd(const_cast<void* const*>(r.stack), r.depth, 1);
+                std::fflush(stdout);
+            }
+#endif
+        }
+        if (total > std::size_t(g_recordCount)) {
+            std::printf("  ... %zu more not recorded\n", total - std::size_t(g_recordCount));
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int warmupFrames = 120;
+    int checkedFrames = 1000;
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--warmup") && i + 1 < argc) warmupFrames = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--frames") && i + 1 < argc) checkedFrames = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--stacks")) g_captureStacks = true;
+    }
+
+#if defined(__GLIBC__)
+    // backtrace() carga libgcc la primera vez; hacerlo ahora evita contarlo como reserva del frame
+    if (g_captureStacks) {
+        void* warm[1];
+        backtrace(warm, 1);
+    }
+#endif
+
+    if (const char* missing = missingRequirement()) {
+        std::printf("FrameAllocCheck: skipped, %s\n", missing);
+        return kSkipCode;
+    }
+
+    AllocHook::set(&recordAllocation);
+
+    BaseApp app;
+    if (!app.init()) {
+        std::fprintf(stderr, "FrameAllocCheck: BaseApp::init() failed\n");
+        return 2;
+    }
+
+    for (int f = 0; f < warmupFrames && app.isRunning(); ++f) {
+        app.runFrame();
+    }
+
+    int frames = 0;
+    g_watching.store(true);
+    for (; frames < checkedFrames && app.isRunning(); ++frames) {
+        g_currentFrame = frames;
+        app.runFrame();
+    }
+    g_watching.store(false);
+
+    printReport(frames);
+    return g_offenders.load() == 0 ? 0 : 1;
+}
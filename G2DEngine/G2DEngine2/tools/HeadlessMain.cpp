@@ -0,0 +1,19 @@
+#include "HeadlessRunner.h"
+#include <iostream>
+
+/**
+ * @file HeadlessMain.cpp
+ * @brief Entrada del binario de simulación headless (G2DEngine2Headless).
+ *
+ * Acepta las mismas opciones que `G2DEngine2 --headless`: [--races N] [--laps N] [--dt S] [--max-time S].
+ */
+int main(int argc, char** argv) {
+    try {
+        HeadlessRunner runner(HeadlessRunner::parseOptions(argc, argv));
+        return runner.run();
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Unhandled exception: " << e.what() << '\n';
+        return -1;
+    }
+}
@@ -0,0 +1,146 @@
+#include "Memory/TSharedPointer.h"
+#include "Memory/TWeakPointer.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+/**
+ * @file SharedPointerRaceCheck.cpp
+ * @brief Verifica que el recuento atómico destruya el objeto exactamente una vez cuando varios
+ * hilos sueltan a la vez las últimas referencias fuertes y débiles.
+ *
+ * En cada ronda se crea un objeto con MakeAtomicShared y cada hilo recibe una referencia fuerte y
+ * una débil; el hilo principal suelta las suyas y todos los hilos liberan a la vez, en un orden
+ * que varía por hilo y ronda (fuerte y luego débil, débil primero, o lock() de la débil
+ * intercalado con la liberación). Al terminar la ronda el destructor debe haberse llamado una
+ * sola vez y ningún lock() debe haber devuelto un objeto ya destruido. En rondas alternas el hilo
+ * principal conserva una referencia débil, para cubrir tanto el caso en que el bloque sobrevive
+ * al objeto como aquel en que lo libera el último hilo.
+ *
+ * Uso: SharedPointerRaceCheck [--rounds N] [--threads N]
+ * Sale con código 1 si alguna ronda falla.
+ */
+
+namespace {
+
+    std::atomic<int> g_destroyed{ 0 };
+    std::atomic<int> g_lockedDead{ 0 };
+
+    struct Tracked {
+        ~Tracked() {
+            alive.store(false, std::memory_order_relaxed);
+            g_destroyed.fetch_add(1, std::memory_order_relaxed);
+        }
+        std::atomic<bool> alive{ true };
+    };
+
+    using EngineUtilities::TAtomicSharedPointer;
+    using Weak = EngineUtilities::TWeakPointer<Tracked, EngineUtilities::AtomicRefCount>;
+
+    struct Slot {
+        TAtomicSharedPointer<Tracked> strong;
+        Weak weak;
+    };
+
+    // Suelta las referencias del hilo en uno de tres órdenes
+    void release(Slot& slot, unsigned order) {
+        switch (order % 3u) {
+        case 0:
+            slot.strong.reset();
+            slot.weak.reset();
+            break;
+        case 1:
+            slot.weak.reset();
+            slot.strong.reset();
+            break;
+        default: {
+            auto locked = slot.weak.lock();
+            slot.strong.reset();
+            if (locked && !locked->alive.load(std::memory_order_relaxed)) {
+                g_lockedDead.fetch_add(1, std::memory_order_relaxed);
+            }
+            locked.reset();
+            slot.weak.reset();
+            break;
+        }
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int rounds = 20000;
+    int threadCount = 4;
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--rounds") && i + 1 < argc) rounds = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--threads") && i + 1 < argc) threadCount = std::atoi(argv[++i]);
+    }
+    if (threadCount < 2) threadCount = 2;
+
+    std::vector<Slot> slots(static_cast<std::size_t>(threadCount));
+    std::atomic<int> round{ -1 };
+    std::atomic<int> finished{ 0 };
+    std::atomic<bool> quit{ false };
+
+    // Hilos persistentes: cada ronda arranca a la vez en todos al publicar el número de ronda
+    std::vector<std::thread> workers;
+    workers.reserve(slots.size());
+    for (int t = 0; t < threadCount; ++t) {
+        workers.emplace_back([&, t]() {
+            int seen = -1;
+            for (;;) {
+                int current;
+                while ((current = round.load(std::memory_order_acquire)) == seen) {
+                    if (quit.load(std::memory_order_acquire)) return;
+                    std::this_thread::yield();
+                }
+                seen = current;
+                release(slots[std::size_t(t)], unsigned(current + t));
+                finished.fetch_add(1, std::memory_order_acq_rel);
+            }
+        });
+    }
+
+    int failures = 0;
+    for (int r = 0; r < rounds; ++r) {
+        g_destroyed.store(0, std::memory_order_relaxed);
+        {
+            auto object = EngineUtilities::MakeAtomicShared<Tracked>();
+            for (auto& slot : slots) {
+                slot.strong = object;
+                slot.weak = Weak(object);
+            }
+        }
+        Weak observer;
+        if (r % 2 == 0) observer = Weak(slots[0].strong);
+
+        finished.store(0, std::memory_order_relaxed);
+        round.store(r, std::memory_order_release);
+        while (finished.load(std::memory_order_acquire) != threadCount) std::this_thread::yield();
+
+        const int destroyed = g_destroyed.load(std::memory_order_relaxed);
+        if (destroyed != 1 || (r % 2 == 0 && !observer.expired())) {
+            if (failures < 10) {
+                std::printf("  [round %d] destructor ran %d times, observer expired: %s\n",
+                    r, destroyed, observer.expired() ? "yes" : "no");
+            }
+            ++failures;
+        }
+    }
+
+    quit.store(true, std::memory_order_release);
+    for (auto& w : workers) w.join();
+
+    const int lockedDead = g_lockedDead.load();
+    if (failures == 0 && lockedDead == 0) {
+        std::printf("SharedPointerRaceCheck: OK, %d rounds x %d threads\n", rounds, threadCount);
+        return 0;
+    }
+    std::printf("SharedPointerRaceCheck: FAIL, %d bad rounds, %d locks of a destroyed object\n",
+        failures, lockedDead);
+    return 1;
+}